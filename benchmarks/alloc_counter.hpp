@@ -0,0 +1,30 @@
+// Global allocation counter for benchmarks that audit heap use. Replaces the global
+// operator new/delete, so include it from exactly one translation unit per benchmark.
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete" // False positive on replaced operator new
+#endif
+
+namespace bench {
+
+inline std::atomic<std::size_t> allocationCount{0};
+
+// Global heap allocations made so far by this process.
+inline std::size_t allocations() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+} // namespace bench
+
+void* operator new(std::size_t size) {
+    bench::allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
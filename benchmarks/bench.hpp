@@ -0,0 +1,53 @@
+// Minimal timing helpers shared by the GoF++ benchmarks (no external deps).
+#pragma once
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace bench {
+
+// Keeps the optimizer from discarding a computed value.
+template <typename T>
+inline void doNotOptimize(T const& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Runs fn() `iters` times and returns nanoseconds per call.
+template <typename Fn>
+double nsPerOp(std::size_t iters, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iters; ++i) fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / double(iters);
+}
+
+// Runs fn(thread_index) `iters` times on each of `threads` threads; returns total ops/second.
+template <typename Fn>
+double opsPerSec(unsigned threads, std::size_t iters, Fn&& fn) {
+    std::vector<std::thread> pool;
+    pool.reserve(threads);
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] { for (std::size_t i = 0; i < iters; ++i) fn(t); });
+    }
+    for (auto& th : pool) th.join();
+    auto end = std::chrono::steady_clock::now();
+    return double(threads) * double(iters) / std::chrono::duration<double>(end - start).count();
+}
+
+// Thread counts 1, 2, 4, ... up to hardware concurrency.
+inline std::vector<unsigned> threadCounts() {
+    unsigned hw = std::thread::hardware_concurrency();
+    if (hw == 0) hw = 4;
+    std::vector<unsigned> counts;
+    for (unsigned n = 1; n < hw; n *= 2) counts.push_back(n);
+    counts.push_back(hw);
+    return counts;
+}
+
+inline void report(const char* name, double value, const char* unit) {
+    std::printf("%-48s %14.2f %s\n", name, value, unit);
+}
+
+} // namespace bench
@@ -0,0 +1,50 @@
+#include <bench.hpp>
+#include <gofpp/creational/abstract_factory.hpp>
+
+using namespace gofpp;
+
+// Virtual family: one vtable hop plus a heap allocation per product.
+struct Button { virtual ~Button() = default; virtual int width() const = 0; };
+struct WinButton : Button { int width() const override { return 80; } };
+struct MacButton : Button { int width() const override { return 96; } };
+struct WinFactory : IAbstractFactory<Button> { std::unique_ptr<Button> create() override { return std::make_unique<WinButton>(); } };
+struct MacFactory : IAbstractFactory<Button> { std::unique_ptr<Button> create() override { return std::make_unique<MacButton>(); } };
+
+// Closed families: value products, no base class.
+struct WinButtonValue { int width() const { return 80; } };
+struct MacButtonValue { int width() const { return 96; } };
+struct WinWidgets { using Button = WinButtonValue; };
+struct MacWidgets { using Button = MacButtonValue; };
+template <typename F> using ButtonOf = typename F::Button;
+
+constexpr std::size_t kIters = 2000000;
+
+int main() {
+    volatile int which = 1; // Runtime family choice
+    std::unique_ptr<IAbstractFactory<Button>> dynamic;
+    if (which) dynamic = std::make_unique<MacFactory>();
+    else dynamic = std::make_unique<WinFactory>();
+
+    long sum = 0;
+    double ns = bench::nsPerOp(kIters, [&] { sum += dynamic->create()->width(); });
+    bench::report("IAbstractFactory::create()->width()", ns, "ns/op");
+
+    VariantFactory<WinWidgets, MacWidgets> ui(static_cast<std::size_t>(which));
+    ns = bench::nsPerOp(kIters, [&] {
+        sum += ui.visit([](auto family) { return family.template create<ButtonOf>().width(); });
+    });
+    bench::report("VariantFactory visit per product", ns, "ns/op");
+
+    ns = bench::nsPerOp(1, [&] {
+        ui.visit([&](auto family) { // Switch once, then a fully static loop
+            for (std::size_t i = 0; i < kIters; ++i) {
+                auto b = family.template create<ButtonOf>();
+                bench::doNotOptimize(b);
+                sum += b.width();
+            }
+        });
+    }) / double(kIters);
+    bench::report("VariantFactory visit once, loop inside", ns, "ns/op");
+    bench::doNotOptimize(sum);
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include <bench.hpp>
+#include <gofpp/creational/builder.hpp>
+
+using namespace gofpp;
+
+struct Message {
+    long id = 0;
+    int priority = 0;
+    double deadline = 0;
+    char tag[32] = {};
+};
+using MessageBuilder = Builder<Message, Required<&Message::id, &Message::priority>>;
+
+constexpr std::size_t kIters = 5000000;
+
+int main() {
+    volatile long seed = 7;
+    double sum = 0;
+
+    double ns = bench::nsPerOp(kIters, [&] {
+        Message m{seed, 3, 1.5, {}};
+        bench::doNotOptimize(m);
+        sum += m.deadline;
+    });
+    bench::report("aggregate initialization", ns, "ns/op");
+
+    ns = bench::nsPerOp(kIters, [&] {
+        MessageBuilder b;
+        Message m = b.set<&Message::id>(seed).set<&Message::priority>(3).set<&Message::deadline>(1.5).build();
+        bench::doNotOptimize(m);
+        sum += m.deadline;
+    });
+    bench::report("Builder set/set/set/build", ns, "ns/op");
+
+    alignas(Message) std::byte storage[sizeof(Message)];
+    ns = bench::nsPerOp(kIters, [&] {
+        Message& m = MessageBuilder::emplace(storage)
+                         .set<&Message::id>(seed).set<&Message::priority>(3).set<&Message::deadline>(1.5).done();
+        bench::doNotOptimize(m);
+        sum += m.deadline;
+    });
+    bench::report("Builder::emplace into caller storage", ns, "ns/op");
+    bench::doNotOptimize(sum);
+    return 0;
+}
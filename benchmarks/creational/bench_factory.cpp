@@ -0,0 +1,63 @@
+#include <bench.hpp>
+#include <gofpp/creational/factory.hpp>
+
+#include <cstdio>
+#include <string>
+
+using namespace gofpp;
+
+struct Shape { virtual ~Shape() = default; virtual int sides() const = 0; };
+struct Circle : Shape { int sides() const override { return 0; } };
+struct Square : Shape { int sides() const override { return 4; } };
+
+constexpr std::size_t kIters = 200000;
+
+template <typename Policy>
+void contention(const char* policyName) {
+    Factory<Shape, Policy> factory;
+    factory.template registerType<Circle>("circle");
+    factory.template registerType<Square>("square");
+    const std::string keys[] = {"circle", "square"};
+
+    for (unsigned threads : bench::threadCounts()) {
+        double ops = bench::opsPerSec(threads, kIters, [&](unsigned t) {
+            auto s = factory.create(keys[t & 1]);
+            bench::doNotOptimize(s);
+        });
+        char name[64];
+        std::snprintf(name, sizeof(name), "create/%s/%u threads", policyName, threads);
+        bench::report(name, ops / 1e6, "Mops/s");
+    }
+}
+
+template <typename Policy>
+void recycling(const char* policyName) {
+    Factory<Shape, Policy> factory;
+    TypeHandle circle = factory.template registerType<Circle>("circle");
+
+    for (unsigned threads : bench::threadCounts()) {
+        double heap = bench::opsPerSec(threads, kIters, [&](unsigned) {
+            auto s = factory.create(circle);
+            bench::doNotOptimize(s);
+        });
+        double pooled = bench::opsPerSec(threads, kIters, [&](unsigned) {
+            auto s = factory.createPooled(circle);
+            bench::doNotOptimize(s);
+        });
+        char name[64];
+        std::snprintf(name, sizeof(name), "create/heap/%s/%u threads", policyName, threads);
+        bench::report(name, heap / 1e6, "Mops/s");
+        std::snprintf(name, sizeof(name), "createPooled/%s/%u threads", policyName, threads);
+        bench::report(name, pooled / 1e6, "Mops/s");
+    }
+    PoolStats stats = factory.poolStats(circle);
+    std::printf("pool: hits=%zu misses=%zu idle=%zu\n", stats.hits, stats.misses, stats.idle);
+}
+
+int main() {
+    contention<MultiThreaded>("MultiThreaded");
+    contention<SharedMutexThreaded>("SharedMutexThreaded");
+    contention<SnapshotThreaded>("SnapshotThreaded");
+    recycling<MultiThreaded>("MultiThreaded");
+    return 0;
+}
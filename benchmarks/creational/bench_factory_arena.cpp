@@ -0,0 +1,37 @@
+#include <bench.hpp>
+#include <gofpp/creational/factory.hpp>
+
+#include <memory_resource>
+#include <vector>
+
+using namespace gofpp;
+
+struct Message { virtual ~Message() = default; virtual int id() const = 0; };
+struct Ping : Message { int payload[6] = {}; int id() const override { return 1; } };
+
+constexpr std::size_t kObjects = 2000; // Objects created per simulated request
+constexpr std::size_t kRequests = 500;
+
+int main() {
+    Factory<Message> factory;
+    TypeHandle ping = factory.registerType<Ping>("ping");
+
+    double ns = bench::nsPerOp(kRequests, [&] {
+        std::vector<std::unique_ptr<Message>> live;
+        live.reserve(kObjects);
+        for (std::size_t i = 0; i < kObjects; ++i) live.push_back(factory.create(ping));
+        bench::doNotOptimize(live.data());
+    });
+    bench::report("global heap: request of 2000 objects", ns / 1000.0, "us");
+
+    std::pmr::unsynchronized_pool_resource upstream;
+    ns = bench::nsPerOp(kRequests, [&] {
+        std::pmr::monotonic_buffer_resource arena(kObjects * sizeof(Ping), &upstream);
+        std::vector<Factory<Message>::ResourcePtr> live;
+        live.reserve(kObjects);
+        for (std::size_t i = 0; i < kObjects; ++i) live.push_back(factory.create(ping, arena));
+        bench::doNotOptimize(live.data());
+    }); // Arena released in one step when it leaves scope
+    bench::report("monotonic arena: request of 2000 objects", ns / 1000.0, "us");
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include <bench.hpp>
+#include <gofpp/creational/factory.hpp>
+
+#include <vector>
+
+using namespace gofpp;
+
+struct Entity { virtual ~Entity() = default; virtual float update(float dt) = 0; };
+struct Particle : Entity {
+    float x = 0, v = 1;
+    float update(float dt) override { x += v * dt; return x; }
+};
+
+constexpr std::size_t kCount = 10000;
+constexpr std::size_t kRounds = 200;
+
+int main() {
+    Factory<Entity> factory;
+    factory.registerType<Particle>("particle");
+
+    // Interleave unrelated allocations so one-at-a-time products scatter like in a real heap.
+    std::vector<std::unique_ptr<Entity>> single;
+    std::vector<std::unique_ptr<char[]>> noise;
+    double ns = bench::nsPerOp(1, [&] {
+        for (std::size_t i = 0; i < kCount; ++i) {
+            single.push_back(factory.create("particle"));
+            noise.push_back(std::make_unique<char[]>(48 + (i % 7) * 16));
+        }
+    });
+    bench::report("create x10000 (one lookup+alloc each)", ns / 1000.0, "us");
+
+    Batch<Entity> batch;
+    ns = bench::nsPerOp(1, [&] { batch = factory.createBatch("particle", kCount); });
+    bench::report("createBatch(10000)", ns / 1000.0, "us");
+
+    float sink = 0;
+    ns = bench::nsPerOp(kRounds, [&] { for (auto& e : single) sink += e->update(0.1f); });
+    bench::report("update pass: individually created", ns / kCount, "ns/object");
+    ns = bench::nsPerOp(kRounds, [&] { for (Entity* e : batch) sink += e->update(0.1f); });
+    bench::report("update pass: batch", ns / kCount, "ns/object");
+    bench::doNotOptimize(sink);
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <alloc_counter.hpp>
+#include <bench.hpp>
+#include <gofpp/creational/factory.hpp>
+#include <gofpp/creational/static_factory.hpp>
+
+#include <cstdio>
+#include <string_view>
+
+using namespace gofpp;
+
+struct Shape { virtual ~Shape() = default; virtual int sides() const = 0; };
+struct Polygon : Shape { int sides() const override { return 5; } };
+
+constexpr std::size_t kIters = 1000000;
+
+int main() {
+    Factory<Shape> factory;
+    // Long key so std::string construction cannot hide inside the small-string buffer.
+    factory.registerType<Polygon>("geometry.primitives.regular_polygon");
+
+    const char* input = "geometry.primitives.regular_polygon;";
+    std::string_view token(input, 35);
+
+    std::size_t before = bench::allocations();
+    double ns = bench::nsPerOp(kIters, [&] {
+        auto s = factory.create(token);
+        bench::doNotOptimize(s);
+    });
+    std::size_t viewAllocs = bench::allocations() - before;
+    bench::report("create(string_view) ns/op", ns, "ns");
+    bench::report("create(string_view) allocations/op", double(viewAllocs) / kIters, "allocs");
+
+    before = bench::allocations();
+    ns = bench::nsPerOp(kIters, [&] {
+        auto s = factory.create(std::string(token)); // Old call pattern: temporary key string
+        bench::doNotOptimize(s);
+    });
+    bench::report("create(std::string(token)) ns/op", ns, "ns");
+    bench::report("create(std::string(token)) allocations/op",
+                  double(bench::allocations() - before) / kIters, "allocs");
+
+    TypeHandle handle = factory.resolve(token);
+    ns = bench::nsPerOp(kIters, [&] {
+        auto s = factory.create(handle);
+        bench::doNotOptimize(s);
+    });
+    bench::report("create(TypeHandle) ns/op", ns, "ns");
+
+    StaticFactory<Shape, Entry<"geometry.primitives.regular_polygon", Polygon>, Entry<"circle", Polygon>> fixed;
+    ns = bench::nsPerOp(kIters, [&] {
+        auto s = fixed.create(token);
+        bench::doNotOptimize(s);
+    });
+    bench::report("StaticFactory::create(string_view) ns/op", ns, "ns");
+
+    // Lookup alone, without the product allocation that dominates create().
+    std::string_view keys[] = {token, "circle", "geometry.primitives.missing", "square"};
+    std::size_t k = 0;
+    double runtimeLookup = bench::nsPerOp(kIters, [&] {
+        auto h = factory.resolve(keys[k++ & 3]);
+        bench::doNotOptimize(h);
+    });
+    double staticLookup = bench::nsPerOp(kIters, [&] {
+        auto i = fixed.indexOf(keys[k++ & 3]);
+        bench::doNotOptimize(i);
+    });
+    bench::report("Factory::resolve(string_view) ns/op", runtimeLookup, "ns");
+    bench::report("StaticFactory::indexOf(string_view) ns/op", staticLookup, "ns");
+
+    // Baseline: a virtual call that allocates the same product.
+    struct Maker { virtual ~Maker() = default; virtual std::unique_ptr<Shape> make() const = 0; };
+    struct PolygonMaker : Maker { std::unique_ptr<Shape> make() const override { return std::make_unique<Polygon>(); } };
+    std::unique_ptr<Maker> maker = std::make_unique<PolygonMaker>();
+    Maker* volatile makerPtr = maker.get();
+    ns = bench::nsPerOp(kIters, [&] {
+        auto s = makerPtr->make();
+        bench::doNotOptimize(s);
+    });
+    bench::report("virtual make() ns/op", ns, "ns");
+
+    // The only allocation on the string_view path must be the product itself, and the
+    // compile-time table must beat the runtime map.
+    return viewAllocs == kIters && staticLookup < runtimeLookup ? 0 : 1;
+}
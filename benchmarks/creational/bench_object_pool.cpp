@@ -0,0 +1,38 @@
+#include <bench.hpp>
+#include <gofpp/creational/object_pool.hpp>
+
+#include <cstdio>
+#include <memory>
+
+using namespace gofpp;
+
+struct Request {
+    char header[64] = {};
+    int id = 0;
+};
+
+constexpr std::size_t kIters = 500000;
+
+int main() {
+    ObjectPool<Request, MultiThreaded> pool(256, [](Request& r) { r.id = 0; });
+
+    for (unsigned threads : bench::threadCounts()) {
+        double heap = bench::opsPerSec(threads, kIters, [](unsigned t) {
+            auto r = std::make_unique<Request>();
+            r->id = int(t);
+            bench::doNotOptimize(r);
+        });
+        double pooled = bench::opsPerSec(threads, kIters, [&](unsigned t) {
+            auto r = pool.acquire();
+            r->id = int(t);
+            bench::doNotOptimize(r);
+        });
+        char name[64];
+        std::snprintf(name, sizeof(name), "make_unique+delete/%u threads", threads);
+        bench::report(name, heap / 1e6, "Mops/s");
+        std::snprintf(name, sizeof(name), "ObjectPool<MultiThreaded>/%u threads", threads);
+        bench::report(name, pooled / 1e6, "Mops/s");
+    }
+    std::printf("objects constructed by pool: %zu\n", pool.size());
+    return 0;
+}
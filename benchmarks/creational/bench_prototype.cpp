@@ -0,0 +1,35 @@
+#include <alloc_counter.hpp>
+#include <bench.hpp>
+#include <gofpp/creational/prototype.hpp>
+
+#include <vector>
+
+using namespace gofpp;
+
+struct Unit : Prototype<Unit> { virtual float hp() const = 0; };
+struct Goblin : Cloneable<Goblin, Unit> { float pos[3] = {}; float health = 7; float hp() const override { return health; } };
+
+constexpr std::size_t kCount = 100000;
+
+int main() {
+    Goblin prefab;
+    float sum = 0;
+
+    std::vector<std::unique_ptr<Unit>> heap;
+    heap.reserve(kCount);
+    std::size_t before = bench::allocations();
+    double ns = bench::nsPerOp(kCount, [&] { heap.push_back(prefab.clone()); });
+    bench::report("clone() -> unique_ptr", ns, "ns/clone");
+    bench::report("clone() allocations/clone", double(bench::allocations() - before) / kCount, "allocs");
+
+    std::vector<PolyValue<Unit>> inlined;
+    inlined.reserve(kCount);
+    before = bench::allocations();
+    ns = bench::nsPerOp(kCount, [&] { inlined.push_back(PolyValue<Unit>::cloneOf(prefab)); });
+    bench::report("PolyValue::cloneOf", ns, "ns/clone");
+    bench::report("PolyValue allocations/clone", double(bench::allocations() - before) / kCount, "allocs");
+
+    for (auto& u : inlined) sum += u->hp();
+    bench::doNotOptimize(sum);
+    return 0;
+}
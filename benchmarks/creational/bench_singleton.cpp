@@ -0,0 +1,43 @@
+#include <bench.hpp>
+#include <gofpp/creational/singleton.hpp>
+
+#include <atomic>
+#include <cstdio>
+
+using namespace gofpp;
+
+struct GlobalCounter : Singleton<GlobalCounter, MultiThreaded> {
+    std::atomic<long> n{0};
+};
+struct Tally { std::atomic<long> n{0}; };
+struct PlainTally { long n = 0; };
+
+constexpr std::size_t kIters = 2000000;
+
+int main() {
+    for (unsigned threads : bench::threadCounts()) {
+        char name[64];
+        double ops = bench::opsPerSec(threads, kIters, [](unsigned) {
+            GlobalCounter::Instance().n.fetch_add(1, std::memory_order_relaxed);
+        });
+        std::snprintf(name, sizeof(name), "Singleton<MultiThreaded>/%u threads", threads);
+        bench::report(name, ops / 1e6, "Mops/s");
+
+        ops = bench::opsPerSec(threads, kIters, [](unsigned) {
+            ShardedSingleton<Tally, 64>::Local().n.fetch_add(1, std::memory_order_relaxed);
+        });
+        std::snprintf(name, sizeof(name), "ShardedSingleton<64>/%u threads", threads);
+        bench::report(name, ops / 1e6, "Mops/s");
+
+        ops = bench::opsPerSec(threads, kIters, [](unsigned) {
+            ThreadLocalSingleton<PlainTally>::Instance().n++;
+        });
+        std::snprintf(name, sizeof(name), "ThreadLocalSingleton/%u threads", threads);
+        bench::report(name, ops / 1e6, "Mops/s");
+    }
+
+    long total = 0;
+    ShardedSingleton<Tally, 64>::forEachShard([&](Tally& t) { total += t.n.load(); });
+    std::printf("sharded total: %ld\n", total);
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include <alloc_counter.hpp>
+#include <bench.hpp>
+#include <gofpp/structural/adapter.hpp>
+
+#include <memory>
+
+using namespace gofpp;
+
+// A short-lived legacy handle.
+struct LegacyHandle {
+    int fd;
+    long offset;
+    long legacyRead(long n) { return offset += n + fd; }
+};
+
+// Classic object adapter: one heap object per wrapped handle.
+struct Reader {
+    virtual ~Reader() = default;
+    virtual long read(long n) = 0;
+};
+struct HandleAdapter : Reader, IAdapter<LegacyHandle> {
+    LegacyHandle handle;
+    explicit HandleAdapter(LegacyHandle h) : handle(h) {}
+    LegacyHandle& getAdapted() override { return handle; }
+    long read(long n) override { return handle.legacyRead(n); }
+};
+
+// The same interface as a static vtable.
+struct ReaderTable {
+    long (*read)(void* self, long n);
+};
+template <>
+inline constexpr ReaderTable gofpp::adapterVTable<ReaderTable, LegacyHandle>{
+    [](void* self, long n) { return static_cast<LegacyHandle*>(self)->legacyRead(n); }};
+
+constexpr std::size_t kIters = 5000000;
+
+int main() {
+    long sum = 0;
+    int fd = 3;
+
+    std::size_t before = bench::allocations();
+    double ns = bench::nsPerOp(kIters, [&] {
+        std::unique_ptr<Reader> r = std::make_unique<HandleAdapter>(LegacyHandle{fd, 0});
+        sum += r->read(8);
+    });
+    bench::report("IAdapter (heap) wrap + call", ns, "ns/op");
+    bench::report("IAdapter allocations/wrap", double(bench::allocations() - before) / kIters, "allocs");
+
+    before = bench::allocations();
+    ns = bench::nsPerOp(kIters, [&] {
+        InlineAdapter<ReaderTable, 16> r(LegacyHandle{fd, 0});
+        bench::doNotOptimize(r);
+        sum += r.call(&ReaderTable::read, 8);
+    });
+    bench::report("InlineAdapter wrap + call", ns, "ns/op");
+    bench::report("InlineAdapter allocations/wrap", double(bench::allocations() - before) / kIters, "allocs");
+
+    bench::doNotOptimize(sum);
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include <bench.hpp>
+#include <gofpp/structural/bridge.hpp>
+
+#include <cstdio>
+#include <memory>
+
+using namespace gofpp;
+
+struct BackendImpl {
+    virtual ~BackendImpl() = default;
+    virtual int draw(int x) = 0;
+};
+
+struct FastBackend : BackendImpl {
+    int draw(int x) override { return x + 1; }
+};
+
+struct SlowBackend : BackendImpl {
+    int draw(int x) override { return x * 3; }
+};
+
+class PlainRenderer : public Bridge<BackendImpl> {
+public:
+    using Bridge::Bridge;
+    int render(int x) { return pin()->draw(x); }
+};
+
+class SharedRenderer : public Bridge<BackendImpl, SnapshotThreaded> {
+public:
+    using Bridge::Bridge;
+    int render(int x) { return pin()->draw(x); }
+};
+
+// The same backends as a closed set: no base class, no virtual functions.
+struct FastInline { int draw(int x) { return x + 1; } };
+struct SlowInline { int draw(int x) { return x * 3; } };
+struct OtherInline { int draw(int x) { return x - 1; } };
+
+class InlineRenderer : public VariantBridge<FastInline, SlowInline, OtherInline> {
+public:
+    int render(int x) { return visit([x](auto& backend) { return backend.draw(x); }); }
+};
+
+constexpr std::size_t kIters = 20000000;
+
+int main() {
+    PlainRenderer plain(std::make_unique<FastBackend>());
+    SharedRenderer shared(std::make_unique<FastBackend>());
+    int x = 0;
+
+    bench::report("Bridge<SingleThreaded> call", bench::nsPerOp(kIters, [&] {
+        x = plain.render(x);
+        bench::doNotOptimize(x);
+    }), "ns/op");
+    bench::report("Bridge<SnapshotThreaded> call", bench::nsPerOp(kIters, [&] {
+        x = shared.render(x);
+        bench::doNotOptimize(x);
+    }), "ns/op");
+
+    // Backend chosen at runtime, so the compiler cannot see which alternative is active.
+    volatile int backend = 0;
+    InlineRenderer inlined;
+    if (backend == 1) inlined.setImpl<SlowInline>();
+    if (backend == 2) inlined.setImpl<OtherInline>();
+    bench::report("VariantBridge call", bench::nsPerOp(kIters, [&] {
+        x = inlined.render(x);
+        bench::doNotOptimize(x);
+    }), "ns/op");
+    bench::doNotOptimize(x);
+
+    for (unsigned threads : bench::threadCounts()) {
+        double ops = bench::opsPerSec(threads, kIters / 4, [&](unsigned t) { bench::doNotOptimize(shared.render(int(t))); });
+        char name[64];
+        std::snprintf(name, sizeof(name), "Bridge<SnapshotThreaded>/%u threads", threads);
+        bench::report(name, ops / 1e6, "Mops/s");
+    }
+
+    double swap = bench::nsPerOp(10000, [&] {
+        shared.setImpl(std::make_unique<SlowBackend>());
+    });
+    bench::report("Bridge<SnapshotThreaded>::setImpl", swap, "ns/op");
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include <bench.hpp>
+#include <gofpp/structural/composite.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace gofpp;
+
+static long sum = 0;
+
+struct RecursiveNode : Composite<RecursiveNode> {
+    long value = 1;
+    void operation() override {
+        sum += value;
+        Composite<RecursiveNode>::operation();
+    }
+};
+
+struct FlatNode : FlatComposite<FlatNode> {
+    long value = 1;
+    void visit() override { sum += value; }
+};
+
+// Builds a tree whose depth-first order is scattered through memory, as in a
+// long-lived scene graph. fanOut 1 gives a chain, large fanOut a wide tree.
+template <typename Node>
+std::vector<std::unique_ptr<Node>> buildTree(std::size_t count, std::size_t fanOut) {
+    std::vector<std::unique_ptr<Node>> nodes;
+    for (std::size_t i = 0; i < count; ++i) nodes.push_back(std::make_unique<Node>());
+    std::shuffle(nodes.begin() + 1, nodes.end(), std::mt19937(42));
+    for (std::size_t i = 1; i < count; ++i) nodes[(i - 1) / fanOut]->add(nodes[i].get());
+    return nodes;
+}
+
+template <typename Node, typename Run>
+void run(const char* name, std::size_t fanOut, Run&& traverse) {
+    constexpr std::size_t kNodes = 100000;
+    auto nodes = buildTree<Node>(kNodes, fanOut);
+    Node& root = *nodes[0];
+    traverse(root); // Warm up (and build the flat layout)
+    double ns = bench::nsPerOp(50, [&] { traverse(root); });
+    bench::doNotOptimize(sum);
+    bench::report(name, ns / double(kNodes), "ns/node");
+}
+
+// Per-node work heavy enough that parallel traversal pays off.
+struct WorkNode : FlatComposite<WorkNode> {
+    double value = 1.0;
+    void visit() override {
+        for (int i = 0; i < 64; ++i) value = value * 0.999 + 0.5;
+    }
+};
+
+void runParallel() {
+    constexpr std::size_t kNodes = 100000;
+    auto nodes = buildTree<WorkNode>(kNodes, 64);
+    WorkNode& root = *nodes[0];
+    double serial = bench::nsPerOp(5, [&] { root.operation(); });
+    bench::report("parallel: serial operation", serial / 1e6, "ms");
+    for (unsigned threads : bench::threadCounts()) {
+        TaskPool pool(threads);
+        for (bool parentsFirst : {false, true}) {
+            ParallelOptions options{.grain = 1024, .parentsFirst = parentsFirst, .pool = &pool};
+            double ns = bench::nsPerOp(5, [&] { root.parallelOperation(options); });
+            char name[64];
+            std::snprintf(name, sizeof(name), "parallel%s/%u threads (speedup)", parentsFirst ? " parents-first" : "", threads);
+            bench::report(name, serial / ns, "x");
+        }
+    }
+}
+
+static std::size_t refreshes = 0;
+
+struct CostNode : AggregateComposite<CostNode, long> {
+    long cost = 1;
+    long local() const override { return cost; }
+    void refresh() override {
+        ++refreshes;
+        AggregateComposite<CostNode, long>::refresh();
+    }
+};
+
+// One tick changes 1% of the nodes; compares a full recompute with update(). Every
+// changed node dirties its ancestors too, so the work to expect is the share of nodes
+// refreshed: scattered changes refresh about 3%, changes to whole sibling groups
+// (one object's parts moving together) close to 1%. Fails if a tick costs more than
+// its share of the full recompute.
+bool runIncremental() {
+    constexpr std::size_t kNodes = 100000;
+    constexpr std::size_t kFanOut = 8;
+    auto nodes = buildTree<CostNode>(kNodes, kFanOut);
+    CostNode& root = *nodes[0];
+    root.update();
+    std::mt19937 rng(7);
+
+    refreshes = 0;
+    double full = bench::nsPerOp(20, [&] {
+        for (auto& n : nodes) n->markDirty();
+        root.update();
+    });
+    std::size_t fullRefreshes = refreshes;
+    bench::report("update: full recompute", full / 1e3, "us/tick");
+
+    bool ok = true;
+    for (bool grouped : {false, true}) {
+        refreshes = 0;
+        double incremental = bench::nsPerOp(20, [&] {
+            for (std::size_t i = 0; i < kNodes / 100;) {
+                std::size_t first = 1 + rng() % (kNodes - 1);
+                if (grouped) first = (first - 1) / kFanOut * kFanOut + 1; // A parent's first child
+                for (std::size_t n = first; n < kNodes && n < first + (grouped ? kFanOut : 1); ++n, ++i) {
+                    ++nodes[n]->cost;
+                    nodes[n]->markDirty();
+                }
+            }
+            root.update();
+        });
+        double share = 100.0 * refreshes / fullRefreshes;
+        double ratio = 100 * incremental / full;
+        char name[64];
+        std::snprintf(name, sizeof(name), "update: 1%% changed, %s", grouped ? "sibling groups" : "scattered");
+        bench::report(name, incremental / 1e3, "us/tick");
+        bench::report("  nodes refreshed / full", share, "%");
+        bench::report("  time / full", ratio, "%");
+        ok = ok && ratio < 1.5 * share;
+    }
+    bench::doNotOptimize(root.aggregate());
+    return ok;
+}
+
+struct KeyNode : KeyedComposite<KeyNode, std::size_t> {
+    std::size_t id = 0;
+    std::size_t key() const { return id; }
+};
+
+// Tearing down a wide node: per-removal cost should not grow with the child count.
+void runTeardown() {
+    for (std::size_t count : {1000, 10000, 100000}) {
+        std::vector<std::unique_ptr<KeyNode>> kids;
+        KeyNode parent;
+        for (std::size_t i = 0; i < count; ++i) {
+            kids.push_back(std::make_unique<KeyNode>());
+            kids.back()->id = i;
+            parent.add(kids.back().get());
+        }
+        char name[64];
+        std::size_t probe = 0;
+        double find = bench::nsPerOp(count, [&] { bench::doNotOptimize(parent.find(probe++ % count)); });
+        std::snprintf(name, sizeof(name), "find by key/%zu children", count);
+        bench::report(name, find, "ns/op");
+
+        std::size_t next = 0;
+        double remove = bench::nsPerOp(count, [&] { parent.remove(kids[next++].get()); });
+        std::snprintf(name, sizeof(name), "remove (first to last)/%zu children", count);
+        bench::report(name, remove, "ns/op");
+    }
+}
+
+int main() {
+    struct Shape { const char* name; std::size_t fanOut; };
+    for (Shape shape : {Shape{"deep (fan-out 2)", 2}, Shape{"wide (fan-out 64)", 64}}) {
+        std::printf("%s\n", shape.name);
+        run<RecursiveNode>("  Composite::operation (recursive)", shape.fanOut,
+                           [](RecursiveNode& r) { r.operation(); });
+        run<FlatNode>("  FlatComposite::operation", shape.fanOut,
+                      [](FlatNode& r) { r.operation(); });
+        run<FlatNode>("  FlatComposite::traverse (no virtual)", shape.fanOut,
+                      [](FlatNode& r) { r.traverse([](FlatNode& n) { sum += n.value; }); });
+    }
+    runTeardown();
+    bool incrementalOk = runIncremental();
+    runParallel();
+    return incrementalOk ? 0 : 1;
+}
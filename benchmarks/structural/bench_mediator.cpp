@@ -0,0 +1,71 @@
+#include <alloc_counter.hpp>
+#include <bench.hpp>
+#include <gofpp/structural/mediator.hpp>
+
+#include <cstdio>
+#include <string>
+#include <thread>
+
+using namespace gofpp;
+
+static long handled = 0;
+
+// The string-routed mediator an editor would write against the Mediator interface.
+struct EditorMediator : Mediator {
+    void notify(const std::string& sender, const std::string& event) override {
+        if (sender == "ViewportPanel" && event == "SelectionChanged") handled += 1;
+        else if (sender == "OutlinerPanel" && event == "SelectionChanged") handled += 2;
+        else if (event == "DocumentModified") handled += 3;
+    }
+};
+
+constexpr std::size_t kIters = 5000000;
+
+int main() {
+    EditorMediator strings;
+    std::size_t before = bench::allocations();
+    double ns = bench::nsPerOp(kIters, [&] { strings.notify("OutlinerPanel", "DocumentModified"); });
+    bench::report("Mediator::notify (strings)", ns, "ns/msg");
+    bench::report("Mediator::notify allocations/msg", double(bench::allocations() - before) / kIters, "allocs");
+
+    TypedMediator<> typed;
+    auto viewport = typed.sender("ViewportPanel");
+    auto outliner = typed.sender("OutlinerPanel");
+    auto selection = typed.event("SelectionChanged");
+    auto modified = typed.event("DocumentModified");
+    typed.on(viewport, selection, [] { handled += 1; });
+    typed.on(outliner, selection, [] { handled += 2; });
+    typed.on(modified, [] { handled += 3; });
+    typed.send(outliner, modified); // Builds the routing table
+
+    before = bench::allocations();
+    ns = bench::nsPerOp(kIters, [&] { typed.send(outliner, modified); });
+    bench::report("TypedMediator::send (interned)", ns, "ns/msg");
+    bench::report("TypedMediator::send allocations/msg", double(bench::allocations() - before) / kIters, "allocs");
+
+    // Async: producers post while one consumer thread drains in batches.
+    for (unsigned producers : bench::threadCounts()) {
+        AsyncMediator<long> bus;
+        long consumed = 0;
+        auto box = bus.add([&](long& v) { consumed += v; }, {.capacity = 4096, .backpressure = Backpressure::Block});
+        const std::size_t total = std::size_t(producers) * (kIters / 10);
+        std::thread consumer([&] {
+            while (bus.stats(box).delivered < total) {
+                if (bus.wait(box, std::chrono::milliseconds(1))) bus.drain(box, 256);
+            }
+        });
+        double ops = bench::opsPerSec(producers, kIters / 10, [&](unsigned) { bus.post(box, 1); });
+        consumer.join();
+        auto s = bus.stats(box);
+        char name[64];
+        std::snprintf(name, sizeof(name), "AsyncMediator::post/%u producers", producers);
+        bench::report(name, ops / 1e6, "Mmsg/s");
+        std::snprintf(name, sizeof(name), "  mean / max latency, high water %zu", s.highWater);
+        bench::report(name, double(s.meanLatency.count()) / 1e3, "us (mean)");
+        bench::report("", double(s.maxLatency.count()) / 1e3, "us (max)");
+        bench::doNotOptimize(consumed);
+    }
+
+    bench::doNotOptimize(handled);
+    return 0;
+}
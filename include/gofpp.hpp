@@ -25,9 +25,11 @@
 // Creational
 #include <gofpp/creational/singleton.hpp>
 #include <gofpp/creational/factory.hpp>
+#include <gofpp/creational/static_factory.hpp>
 #include <gofpp/creational/abstract_factory.hpp>
 #include <gofpp/creational/builder.hpp>
 #include <gofpp/creational/prototype.hpp>
+#include <gofpp/creational/object_pool.hpp>
 
 // Structural
 #include <gofpp/structural/composite.hpp>
@@ -26,6 +26,8 @@
  * @section threading Threading
  * - Default: `SingleThreaded` (no locking).
  * - Optional: `MultiThreaded` (mutex-protected).
+ * - Optional: `SharedMutexThreaded` (concurrent `notify`, exclusive subscribe/unsubscribe).
+ * - Observers must not subscribe/unsubscribe from inside `onNotify` under a locking policy.
  *
  * 
  * @version 0.1
@@ -34,8 +36,10 @@
  * GPLv3 License - Copyright (c) 2025 Noah G. Wood
  */
 #pragma once
+#include <algorithm>
 #include <functional>
 #include <unordered_map>
+#include <vector>
 #include <mutex>
 #include <gofpp/threading.hpp>
 
@@ -51,17 +55,20 @@ namespace gofpp
 
     // Observable (subject)
     template<typename T, typename ThreadPolicy = SingleThreaded>
-    class Observable {
+    class Observable : private ThreadPolicy {
     public:
         void subscribe(Observer<T>* obs) {
+            typename ThreadPolicy::Lock lock(*this);
             observers.push_back(obs);
         }
 
         void unsubscribe(Observer<T>* obs) {
+            typename ThreadPolicy::Lock lock(*this);
             observers.erase(std::remove(observers.begin(), observers.end(), obs), observers.end());
         }
 
         void notify(const T& event) {
+            typename ThreadPolicy::SharedLock lock(*this);
             for (auto* obs : observers) {
                 obs->onNotify(event);
             }
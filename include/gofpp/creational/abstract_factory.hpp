@@ -9,6 +9,9 @@
  * - Create related objects (e.g., UI widgets) via a unified interface.
  * - Combine with Factory for dynamic type registration.
  * - Thread-policy configurable.
+ * - Closed families known at compile time can skip virtual calls and heap allocation:
+ *   `FamilyFactory<Family>` creates products by value from a family tag, and
+ *   `VariantFactory<Families...>` picks the family at runtime with a single switch.
  *
  * @section usage Example Usage
  * ```cpp
@@ -29,6 +32,19 @@
  * };
  * ```
  *
+ * Static dispatch over a closed set of families:
+ * ```cpp
+ * struct WinWidgets { using Button = WinButtonValue; using Checkbox = WinCheckbox; };
+ * struct MacWidgets { using Button = MacButtonValue; using Checkbox = MacCheckbox; };
+ * template <typename F> using ButtonOf = typename F::Button;
+ *
+ * gofpp::VariantFactory<WinWidgets, MacWidgets> ui(isMac ? 1 : 0);
+ * ui.visit([](auto family) {             // One switch here...
+ *     auto b = family.template create<ButtonOf>();
+ *     b.draw();                           // ...then direct, inlinable calls
+ * });
+ * ```
+ *
  * @version 0.1
  * @date 2025-08-05
  * @copyright
@@ -36,7 +52,11 @@
  */
 
 #pragma once
+#include <cstddef>
 #include <memory>
+#include <stdexcept>
+#include <utility>
+#include <variant>
 
 namespace gofpp {
 
@@ -49,4 +69,79 @@ public:
     virtual ~IAbstractFactory() = default;
     virtual std::unique_ptr<AbstractProduct> create() = 0;
 };
+
+/**
+ * @brief Compile-time abstract factory for one product family.
+ * `Role` maps a family to one of its product types, e.g.
+ * `template <typename F> using ButtonOf = typename F::Button;`.
+ */
+template <typename Family>
+struct FamilyFactory {
+    using family = Family;
+
+    template <template <typename> class Role, typename... Args>
+    static constexpr Role<Family> create(Args&&... args) {
+        return Role<Family>(std::forward<Args>(args)...);
+    }
+};
+
+/**
+ * @brief Abstract factory over a closed set of families chosen at runtime.
+ * `visit` switches once on the active family and runs fully static code for it;
+ * `create` returns the product inline in a `std::variant`.
+ */
+template <typename... Families>
+class VariantFactory {
+public:
+    static_assert(sizeof...(Families) > 0, "VariantFactory needs at least one family");
+
+    constexpr VariantFactory() = default;
+
+    template <typename Family>
+    constexpr explicit VariantFactory(std::in_place_type_t<Family>)
+        : active(std::in_place_type<FamilyFactory<Family>>) {}
+
+    // Selects the family by its position in Families...; throws std::out_of_range if there is none.
+    explicit VariantFactory(std::size_t index) { select(index); }
+
+    template <typename Family>
+    constexpr void select() { active.template emplace<FamilyFactory<Family>>(); }
+
+    void select(std::size_t index) {
+        static constexpr Alternative table[] = {
+            [](Active& a) { a.template emplace<FamilyFactory<Families>>(); }...};
+        if (index >= sizeof...(Families)) throw std::out_of_range("VariantFactory: family index out of range");
+        table[index](active);
+    }
+
+    std::size_t index() const noexcept { return active.index(); }
+
+    // Invokes fn(FamilyFactory<ActiveFamily>{}).
+    template <typename Fn>
+    constexpr decltype(auto) visit(Fn&& fn) const {
+        return std::visit(std::forward<Fn>(fn), active);
+    }
+
+    // Alternative i holds family i's product, so families may share a product type.
+    template <template <typename> class Role, typename... Args>
+    constexpr std::variant<Role<Families>...> create(Args&&... args) const {
+        return std::visit([&](auto family) -> std::variant<Role<Families>...> {
+            using Family = typename decltype(family)::family;
+            return std::variant<Role<Families>...>(std::in_place_index<indexOf<Family>()>, std::forward<Args>(args)...);
+        }, active);
+    }
+
+private:
+    template <typename Family>
+    static constexpr std::size_t indexOf() {
+        constexpr bool match[] = {std::is_same_v<Family, Families>...};
+        std::size_t i = 0;
+        while (!match[i]) ++i;
+        return i;
+    }
+
+    using Active = std::variant<FamilyFactory<Families>...>;
+    using Alternative = void (*)(Active&);
+    Active active;
+};
 } // namespace gofpp
@@ -8,6 +8,10 @@
  * @section features Key Features
  * - Incrementally construct objects (e.g., GUI layouts, config objects).
  * - Reusable builders for different products.
+ * - `Builder<Product, Required<&Product::field...>>` tracks which required fields were set
+ *   in its type: `build()` on an incomplete builder does not compile. Fields are written
+ *   straight into the product (owned by the builder or placed in caller storage), so
+ *   building costs the same stores as aggregate initialization plus at most one move.
  *
  * @section usage Example Usage
  * ```cpp
@@ -23,6 +27,16 @@
  * };
  *
  * Car c = CarBuilder().setWheels(4).addSunroof().build();
+ *
+ * struct Config { std::string host; int port = 0; bool tls = false; };
+ * using ConfigBuilder = gofpp::Builder<Config, gofpp::Required<&Config::host, &Config::port>>;
+ *
+ * ConfigBuilder b;
+ * Config cfg = b.set<&Config::host>("db").set<&Config::port>(5432).build();
+ * // b.set<&Config::host>("db").build(); // Error: port is required
+ *
+ * alignas(Config) std::byte buf[sizeof(Config)];
+ * Config& placed = ConfigBuilder::emplace(buf).set<&Config::host>("db").set<&Config::port>(1).done();
  * ```
  *
  * @version 0.1
@@ -32,6 +46,10 @@
  */
 
 #pragma once
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace gofpp {
 
@@ -46,4 +64,92 @@ public:
     virtual Product build() = 0;
 };
 
+/**
+ * @brief List of data members a `Builder` must set before it can build.
+ */
+template <auto... Members>
+struct Required {
+    static_assert(sizeof...(Members) <= 64, "At most 64 required fields");
+};
+
+namespace detail {
+
+template <auto A, auto B>
+constexpr bool sameMember() {
+    if constexpr (std::is_same_v<decltype(A), decltype(B)>) return A == B;
+    else return false;
+}
+
+// Bit for Member within Required<Members...>, or 0 if the member is optional.
+template <auto Member, auto... Members>
+constexpr std::uint64_t fieldBit() {
+    std::uint64_t bit = 0, i = 0;
+    ((bit |= sameMember<Member, Members>() ? std::uint64_t{1} << i : 0, ++i), ...);
+    return bit;
+}
+
+} // namespace detail
+
+template <typename Product, typename Req, std::uint64_t Set = 0>
+class FieldBuilder;
+
+/**
+ * @brief Typestate view over a product under construction. Each `set` writes the member
+ * in place and returns a view whose type records the field; nothing is copied.
+ */
+template <typename Product, auto... Members, std::uint64_t Set>
+class [[nodiscard]] FieldBuilder<Product, Required<Members...>, Set> {
+public:
+    static constexpr std::uint64_t required = (std::uint64_t{0} | ... | detail::fieldBit<Members, Members...>());
+    static constexpr bool complete = (Set & required) == required;
+
+    explicit FieldBuilder(Product& target) noexcept : target(&target) {}
+
+    template <auto Member, typename V>
+    FieldBuilder<Product, Required<Members...>, Set | detail::fieldBit<Member, Members...>()> set(V&& value) && {
+        target->*Member = std::forward<V>(value);
+        return FieldBuilder<Product, Required<Members...>, Set | detail::fieldBit<Member, Members...>()>(*target);
+    }
+
+    // Untracked mutation for anything that is not a plain assignment.
+    template <typename Fn>
+    FieldBuilder apply(Fn&& fn) && {
+        std::forward<Fn>(fn)(*target);
+        return *this;
+    }
+
+    // Moves the finished product out.
+    Product build() && requires complete { return std::move(*target); }
+
+    // Finishes in place (e.g. after Builder::emplace) without moving.
+    Product& done() && requires complete { return *target; }
+
+private:
+    Product* target;
+};
+
+/**
+ * @brief Owns a product under construction and starts typed `FieldBuilder` chains.
+ */
+template <typename Product, typename Req = Required<>>
+class Builder {
+public:
+    using View = FieldBuilder<Product, Req>;
+
+    // Chains borrow this builder's product, so it must be an lvalue that outlives them.
+    template <auto Member, typename V>
+    auto set(V&& value) & { return View(product).template set<Member>(std::forward<V>(value)); }
+    template <auto Member, typename V>
+    auto set(V&&) && = delete;
+
+    // Builds into an existing object.
+    static View into(Product& target) noexcept { return View(target); }
+
+    // Value-initializes Product in caller storage and builds there.
+    static View emplace(void* storage) { return View(*::new (storage) Product{}); }
+
+private:
+    Product product{};
+};
+
 } // namespace gofpp
@@ -8,6 +8,18 @@
  * @section features Key Features
  * - Register derived types at runtime with string identifiers.
  * - Create instances of registered types using `std::unique_ptr`.
+ * - Keys are looked up heterogeneously: `create` accepts `std::string_view`,
+ *   `const char*` or `std::string` without building a temporary string.
+ * - `registerType` returns a `TypeHandle`; `create(handle)` indexes a dense creator
+ *   table with no hashing. `resolve(key)` turns a key into a handle once at setup.
+ * - Products can be created in a `std::pmr::memory_resource` (for example a
+ *   `std::pmr::monotonic_buffer_resource` used as a request arena) or constructed into
+ *   caller-provided storage, each with a matching deleter.
+ * - `createPooled` recycles storage through per-type free lists with thread-local caches;
+ *   `poolStats`, `setPoolCapacity` and `trim` size and shrink the pools.
+ * - `createBatch(key, n)` does one lookup and one allocation for n contiguous products.
+ * - `Factory<Base, Base(Args...)>` forwards constructor arguments through `create(key, args...)`,
+ *   so products need not be default-constructible. Creators are plain function pointers.
  * - Thread-policy configurable for concurrent registration and creation.
  *
  * @section usage Example Usage
@@ -21,11 +33,26 @@
  *
  * auto shape = factory.create("circle");
  * shape->draw();
+ *
+ * gofpp::TypeHandle square = factory.resolve("square");
+ * auto fast = factory.create(square); // No string hash or compare
+ *
+ * std::pmr::monotonic_buffer_resource arena;
+ * auto pooled = factory.create("circle", arena); // Freed when the arena is released
+ *
+ * struct Disk : Shape { const double r; explicit Disk(double r) : r(r) {} void draw() override {} };
+ * gofpp::Factory<Shape, Shape(double)> sized;
+ * sized.registerType<Disk>("disk");
+ * auto d = sized.create("disk", 2.5); // Constructed in one step
  * ```
  *
  * @section threading Threading
  * - Default: `SingleThreaded` (no locking).
  * - Optional: `MultiThreaded` (mutex-protected).
+ * - Optional: `SharedMutexThreaded` (`create` takes a shared lock, `registerType` an exclusive one).
+ * - Optional: `SnapshotThreaded` (`create` reads an immutable snapshot with no lock;
+ *   `registerType` copies and republishes it). A superseded snapshot is freed once
+ *   every `create` that might still read it has returned.
  * 
  * @version 0.1
  * @date 2025-08-05 
@@ -34,38 +61,558 @@
  */
 
 #pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <unordered_map>
 #include <memory>
+#include <memory_resource>
+#include <new>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
 #include <gofpp/threading.hpp>
+#include <gofpp/detail/string_hash.hpp>
 
 namespace gofpp {
 
-template <typename Base, typename ThreadPolicy = SingleThreaded>
-class Factory : private ThreadPolicy {
+/**
+ * @brief Compact handle to a registered Factory type, for dispatch without hashing.
+ */
+struct TypeHandle {
+    static constexpr std::uint32_t invalid = ~std::uint32_t{0};
+    std::uint32_t index = invalid;
+
+    explicit operator bool() const noexcept { return index != invalid; }
+    friend bool operator==(TypeHandle, TypeHandle) = default;
+};
+
+/**
+ * @brief Size and alignment of a registered product, for sizing caller-provided storage.
+ */
+struct TypeLayout {
+    std::size_t size = 0;
+    std::size_t align = 0;
+};
+
+/**
+ * @brief Deleter for products created in a `std::pmr::memory_resource`.
+ */
+template <typename Base>
+struct ResourceDeleter {
+    std::pmr::memory_resource* resource = nullptr;
+    TypeLayout layout;
+
+    void operator()(Base* p) const {
+        void* storage = dynamic_cast<void*>(p); // Most-derived address the resource handed out
+        p->~Base();
+        resource->deallocate(storage, layout.size, layout.align);
+    }
+};
+
+/**
+ * @brief Deleter for products placed in caller-owned storage: destroys, never frees.
+ */
+template <typename Base>
+struct DestroyDeleter {
+    void operator()(Base* p) const { p->~Base(); }
+};
+
+/**
+ * @brief Counters for one recycling pool (see `BasicFactory::createPooled`).
+ */
+struct PoolStats {
+    std::size_t hits = 0;     // Creates served from recycled storage
+    std::size_t misses = 0;   // Creates that had to allocate
+    std::size_t idle = 0;     // Blocks waiting in the shared free list
+    std::size_t live = 0;     // Pooled products currently alive
+    std::size_t capacity = 0; // Cap on the shared free list
+};
+
+namespace detail {
+
+// Per-thread bins of recycled blocks. On eviction or thread exit the blocks go back to
+// their pool's shared free list; they are plain aligned ::operator new storage, so a bin
+// frees them itself once the pool is gone.
+struct RecycleBin {
+    TypeLayout layout;
+    void* counters = nullptr; // Owned by the pool; only touched while the bin is the pool's
+    std::weak_ptr<void> owner;
+    void (*giveBack)(void* owner, void** blocks, std::uint32_t count) = nullptr;
+
+    static void dispose(RecycleBin& bin, void** blocks, std::uint32_t count) {
+        if (auto pool = bin.owner.lock()) return bin.giveBack(pool.get(), blocks, count);
+        while (count) ::operator delete(blocks[--count], bin.layout.size, std::align_val_t(bin.layout.align));
+    }
+};
+
+using RecycleCache = ThreadCache<RecycleBin>;
+
+// Recycles storage blocks of one layout: an intrusive free list shared under ThreadPolicy,
+// fronted by the thread-local cache for locking policies.
+template <typename ThreadPolicy>
+class RecyclePool : private ThreadPolicy, public std::enable_shared_from_this<RecyclePool<ThreadPolicy>> {
+    static constexpr bool cached = !std::is_same_v<ThreadPolicy, SingleThreaded>;
+
 public:
-    using Creator = std::function<std::unique_ptr<Base>()>;
+    explicit RecyclePool(TypeLayout layout) : layout(layout) {}
+    ~RecyclePool() { freeList(takeShared()); }
 
-    template <typename Derived>
-    void registerType(const std::string& key) {
+    RecyclePool(const RecyclePool&) = delete;
+    RecyclePool& operator=(const RecyclePool&) = delete;
+
+    void* acquire() {
+        if constexpr (cached) {
+            auto& b = bin();
+            Counters& c = *static_cast<Counters*>(b.counters);
+            bump(c.live, 1);
+            if (b.count == 0) refill(b);
+            if (b.count) {
+                bump(c.hits, 1);
+                return b.items[--b.count];
+            }
+            bump(c.misses, 1);
+        } else {
+            bump(local.live, 1);
+            if (Node* n = pop()) {
+                bump(local.hits, 1);
+                return n;
+            }
+            bump(local.misses, 1);
+        }
+        return ::operator new(layout.size, std::align_val_t(layout.align));
+    }
+
+    void release(void* block) {
+        if constexpr (cached) {
+            auto& b = bin();
+            bump(static_cast<Counters*>(b.counters)->live, std::size_t(-1));
+            if (b.count == RecycleCache::depth) flush(b, RecycleCache::depth / 2);
+            b.items[b.count++] = block;
+        } else {
+            bump(local.live, std::size_t(-1));
+            typename ThreadPolicy::Lock lock(*this);
+            push(block);
+        }
+    }
+
+    // Frees the shared free list and the calling thread's cached blocks.
+    void trim() {
+        if constexpr (cached) {
+            std::uint64_t taken = id.load(std::memory_order_relaxed);
+            if (auto* b = taken ? RecycleCache::local().find(taken) : nullptr) b->drain();
+        }
+        freeList(takeShared());
+    }
+
+    void setCapacity(std::size_t cap) { capacity.store(cap, std::memory_order_relaxed); }
+
+    PoolStats stats() {
         typename ThreadPolicy::Lock lock(*this);
-        creators[key] = []() -> std::unique_ptr<Base> {
-            return std::make_unique<Derived>();
+        PoolStats out;
+        auto add = [&](const Counters& c) {
+            out.hits += c.hits.load(std::memory_order_relaxed);
+            out.misses += c.misses.load(std::memory_order_relaxed);
+            out.live += c.live.load(std::memory_order_relaxed); // Per-thread values wrap; the sum is exact
         };
+        add(local);
+        for (auto& [thread, c] : perThread) add(*c);
+        out.idle = idle;
+        out.capacity = capacity.load(std::memory_order_relaxed);
+        return out;
+    }
+
+private:
+    struct Node { Node* next; };
+
+    // Single-writer counters: each thread owns one block, so updates are plain stores
+    // (no locked read-modify-write) and stats() sums the blocks.
+    struct alignas(64) Counters {
+        std::atomic<std::size_t> hits{0}, misses{0}, live{0};
+    };
+
+    static void bump(std::atomic<std::size_t>& counter, std::size_t delta) {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    // Claiming the bin hands another pool's blocks back to it first.
+    RecycleCache::Bin& bin() {
+        auto& b = RecycleCache::local().binFor(cacheId(), [&](RecycleBin& fresh) {
+            fresh.layout = layout;
+            fresh.counters = nullptr;
+            fresh.owner = std::static_pointer_cast<void>(this->shared_from_this());
+            fresh.giveBack = [](void* pool, void** blocks, std::uint32_t n) {
+                static_cast<RecyclePool*>(pool)->giveBack(blocks, n);
+            };
+        });
+        if (!b.counters) {
+            typename ThreadPolicy::Lock lock(*this);
+            auto& c = perThread[std::this_thread::get_id()];
+            if (!c) c = std::make_unique<Counters>();
+            b.counters = c.get();
+        }
+        return b;
     }
 
-    std::unique_ptr<Base> create(const std::string& key) {
+    // Cache id, taken on first use: registering a type that is never pooled costs no id.
+    std::uint64_t cacheId() {
+        std::uint64_t current = id.load(std::memory_order_relaxed);
+        if (current) return current;
+        std::uint64_t fresh = RecycleCache::nextId();
+        return id.compare_exchange_strong(current, fresh, std::memory_order_relaxed) ? fresh : current;
+    }
+
+    void giveBack(void** blocks, std::uint32_t n) {
         typename ThreadPolicy::Lock lock(*this);
-        auto it = creators.find(key);
-        if (it != creators.end()) {
-            return it->second();
+        while (n) push(blocks[--n]);
+    }
+
+    // Callers hold the lock.
+    void push(void* block) {
+        if (idle >= capacity.load(std::memory_order_relaxed)) {
+            ::operator delete(block, layout.size, std::align_val_t(layout.align));
+            return;
         }
-        return nullptr;
+        head = ::new (block) Node{head};
+        ++idle;
     }
 
+    Node* pop() {
+        typename ThreadPolicy::Lock lock(*this);
+        Node* n = head;
+        if (n) {
+            head = n->next;
+            --idle;
+        }
+        return n;
+    }
+
+    void refill(RecycleCache::Bin& b) {
+        typename ThreadPolicy::Lock lock(*this);
+        while (head && b.count < RecycleCache::depth / 2) {
+            b.items[b.count++] = head;
+            head = head->next;
+            --idle;
+        }
+    }
+
+    void flush(RecycleCache::Bin& b, std::uint32_t n) {
+        typename ThreadPolicy::Lock lock(*this);
+        while (n-- && b.count) push(b.items[--b.count]);
+    }
+
+    Node* takeShared() {
+        typename ThreadPolicy::Lock lock(*this);
+        Node* n = head;
+        head = nullptr;
+        idle = 0;
+        return n;
+    }
+
+    void freeList(Node* n) {
+        while (n) {
+            Node* next = n->next;
+            ::operator delete(n, layout.size, std::align_val_t(layout.align));
+            n = next;
+        }
+    }
+
+    const TypeLayout layout;
+    std::atomic<std::uint64_t> id{0};
+    Node* head = nullptr;
+    std::size_t idle = 0;
+    std::atomic<std::size_t> capacity{1024};
+    Counters local; // Used when the policy does not cache per thread
+    std::unordered_map<std::thread::id, std::unique_ptr<Counters>> perThread;
+};
+
+} // namespace detail
+
+/**
+ * @brief Deleter for pooled products: destroys, then returns the storage to its pool.
+ */
+template <typename Base, typename Pool>
+struct RecycleDeleter {
+    Pool* pool = nullptr;
+
+    void operator()(Base* p) const {
+        void* storage = dynamic_cast<void*>(p);
+        p->~Base();
+        pool->release(storage);
+    }
+};
+
+/**
+ * @brief N products of one registered type laid out contiguously in a single allocation.
+ * Iterating yields `Base*` in creation order; destroying the batch destroys every product.
+ */
+template <typename Base>
+class Batch {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Base*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Base*;
+
+        iterator() = default;
+        Base* operator*() const { return std::launder(reinterpret_cast<Base*>(pos)); }
+        iterator& operator++() { pos += stride; return *this; }
+        iterator operator++(int) { iterator old = *this; pos += stride; return old; }
+        friend bool operator==(const iterator&, const iterator&) = default;
+
+    private:
+        friend class Batch;
+        iterator(std::byte* pos, std::size_t stride) : pos(pos), stride(stride) {}
+        std::byte* pos = nullptr;
+        std::size_t stride = 0;
+    };
+
+    Batch() = default;
+    Batch(Batch&& other) noexcept { swap(other); }
+    Batch& operator=(Batch other) noexcept { swap(other); return *this; }
+    ~Batch() {
+        for (Base* p : *this) p->~Base();
+        if (storage) ::operator delete(storage, capacity * layout.size, std::align_val_t(layout.align));
+    }
+
+    iterator begin() const { return {storage + offset, layout.size}; }
+    iterator end() const { return {storage + offset + count * layout.size, layout.size}; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    Base* operator[](std::size_t i) const { return *iterator{storage + offset + i * layout.size, layout.size}; }
+
 private:
-    std::unordered_map<std::string, Creator> creators;
+    template <typename, typename, typename...>
+    friend class BasicFactory;
+
+    void swap(Batch& other) noexcept {
+        std::swap(storage, other.storage);
+        std::swap(count, other.count);
+        std::swap(capacity, other.capacity);
+        std::swap(offset, other.offset);
+        std::swap(layout, other.layout);
+    }
+
+    std::byte* storage = nullptr;
+    std::size_t count = 0;    // Constructed products
+    std::size_t capacity = 0; // Products the storage was sized for
+    std::size_t offset = 0;   // Base subobject offset within each product
+    TypeLayout layout;        // size doubles as the stride
 };
 
+/**
+ * @brief Factory implementation whose products are constructed from `Args...`.
+ * Use through `Factory<Base, ThreadPolicy>` or `Factory<Base, Base(Args...), ThreadPolicy>`.
+ */
+template <typename Base, typename ThreadPolicy = SingleThreaded, typename... Args>
+class BasicFactory {
+    static_assert(std::has_virtual_destructor_v<Base>, "Factory products are destroyed through Base*");
+
+public:
+    using Creator = std::unique_ptr<Base> (*)(Args...); // Captureless: calls never allocate
+    using ResourcePtr = std::unique_ptr<Base, ResourceDeleter<Base>>;
+    using PlacedPtr = std::unique_ptr<Base, DestroyDeleter<Base>>;
+    using Pool = detail::RecyclePool<LockingPolicy<ThreadPolicy>>;
+    using PooledPtr = std::unique_ptr<Base, RecycleDeleter<Base, Pool>>;
+
+    // Re-registering a key keeps its handle and replaces the creator.
+    template <typename Derived>
+    TypeHandle registerType(std::string_view key) {
+        static_assert(std::is_constructible_v<Derived, Args...>, "Derived must be constructible from the Factory signature");
+        Slot slot{
+            [](Args... args) -> std::unique_ptr<Base> {
+                return std::make_unique<Derived>(std::forward<Args>(args)...);
+            },
+            [](void* storage, Args... args) -> Base* {
+                return ::new (storage) Derived(std::forward<Args>(args)...);
+            },
+            TypeLayout{sizeof(Derived), alignof(Derived)},
+            std::make_shared<Pool>(TypeLayout{sizeof(Derived), alignof(Derived)}),
+        };
+        return registry.write([&](Registry& r) {
+            auto it = r.handles.find(key);
+            if (it != r.handles.end()) {
+                r.retiredPools.push_back(r.slots[it->second.index].pool); // Live products may still return to it
+                r.slots[it->second.index] = std::move(slot);
+                return it->second;
+            }
+            TypeHandle handle{static_cast<std::uint32_t>(r.slots.size())};
+            r.slots.push_back(std::move(slot));
+            r.handles.emplace(std::string(key), handle);
+            return handle;
+        });
+    }
+
+    // Resolves a key once at setup; returns an invalid handle for unknown keys.
+    TypeHandle resolve(std::string_view key) {
+        return registry.read([&](const Registry& r) {
+            auto it = r.handles.find(key);
+            return it != r.handles.end() ? it->second : TypeHandle{};
+        });
+    }
+
+    std::unique_ptr<Base> create(TypeHandle handle, Args... args) {
+        return registry.read([&](const Registry& r) -> std::unique_ptr<Base> {
+            const Slot* slot = r.find(handle);
+            return slot ? slot->create(std::forward<Args>(args)...) : nullptr;
+        });
+    }
+
+    std::unique_ptr<Base> create(std::string_view key, Args... args) {
+        return registry.read([&](const Registry& r) -> std::unique_ptr<Base> {
+            const Slot* slot = r.find(key);
+            return slot ? slot->create(std::forward<Args>(args)...) : nullptr;
+        });
+    }
+
+    // Allocates from resource (e.g. a request-scoped std::pmr::monotonic_buffer_resource,
+    // whose memory is released all at once) instead of the global heap.
+    template <typename Key>
+    ResourcePtr create(const Key& key, std::pmr::memory_resource& resource, Args... args) {
+        return registry.read([&](const Registry& r) -> ResourcePtr {
+            const Slot* slot = r.find(key);
+            if (!slot) return nullptr;
+            void* storage = resource.allocate(slot->layout.size, slot->layout.align);
+            try {
+                return ResourcePtr(slot->construct(storage, std::forward<Args>(args)...),
+                                   ResourceDeleter<Base>{&resource, slot->layout});
+            } catch (...) {
+                resource.deallocate(storage, slot->layout.size, slot->layout.align);
+                throw;
+            }
+        });
+    }
+
+    // Constructs into caller storage; returns null if the key is unknown or the
+    // storage is too small or misaligned (see layout()).
+    template <typename Key>
+    PlacedPtr createAt(const Key& key, void* storage, std::size_t capacity, Args... args) {
+        return registry.read([&](const Registry& r) -> PlacedPtr {
+            const Slot* slot = r.find(key);
+            if (!slot || !std::align(slot->layout.align, slot->layout.size, storage, capacity)) return nullptr;
+            return PlacedPtr(slot->construct(storage, std::forward<Args>(args)...));
+        });
+    }
+
+    // Creates into storage recycled from the key's pool; releasing the handle destroys the
+    // product and returns the storage. Pooled products must not outlive the factory.
+    template <typename Key>
+    PooledPtr createPooled(const Key& key, Args... args) {
+        return registry.read([&](const Registry& r) -> PooledPtr {
+            const Slot* slot = r.find(key);
+            if (!slot) return nullptr;
+            Pool* pool = slot->pool.get();
+            void* storage = pool->acquire();
+            try {
+                return PooledPtr(slot->construct(storage, std::forward<Args>(args)...),
+                                 RecycleDeleter<Base, Pool>{pool});
+            } catch (...) {
+                pool->release(storage);
+                throw;
+            }
+        });
+    }
+
+    // Looks the key up once and constructs n products back to back in one allocation.
+    // Returns an empty batch for unknown keys.
+    template <typename Key>
+    Batch<Base> createBatch(const Key& key, std::size_t n, Args... args) {
+        return registry.read([&](const Registry& r) {
+            Batch<Base> batch;
+            const Slot* slot = r.find(key);
+            if (!slot || n == 0) return batch;
+            if (n > std::numeric_limits<std::size_t>::max() / slot->layout.size) throw std::bad_array_new_length();
+            batch.layout = slot->layout;
+            batch.storage = static_cast<std::byte*>(
+                ::operator new(n * slot->layout.size, std::align_val_t(slot->layout.align)));
+            batch.capacity = n;
+            for (std::size_t i = 0; i < n; ++i) {
+                std::byte* at = batch.storage + i * slot->layout.size;
+                Base* product = slot->construct(at, args...); // On throw, ~Batch cleans up the first i
+                if (i == 0) batch.offset = reinterpret_cast<std::byte*>(product) - at;
+                ++batch.count;
+            }
+            return batch;
+        });
+    }
+
+    template <typename Key>
+    PoolStats poolStats(const Key& key) {
+        return registry.read([&](const Registry& r) {
+            const Slot* slot = r.find(key);
+            return slot ? slot->pool->stats() : PoolStats{};
+        });
+    }
+
+    // Caps how many idle blocks the key's shared free list keeps (default 1024).
+    template <typename Key>
+    void setPoolCapacity(const Key& key, std::size_t capacity) {
+        registry.read([&](const Registry& r) {
+            if (const Slot* slot = r.find(key)) slot->pool->setCapacity(capacity);
+        });
+    }
+
+    // Frees idle pooled storage (shared lists and the calling thread's caches).
+    void trim() {
+        registry.read([](const Registry& r) {
+            for (auto& slot : r.slots) slot.pool->trim();
+            for (auto& pool : r.retiredPools) pool->trim();
+        });
+    }
+
+    template <typename Key>
+    TypeLayout layout(const Key& key) {
+        return registry.read([&](const Registry& r) {
+            const Slot* slot = r.find(key);
+            return slot ? slot->layout : TypeLayout{};
+        });
+    }
+
+    // Frees snapshots superseded by a registerType() made inside a create(), which could not wait.
+    void reclaim() requires std::is_same_v<ThreadPolicy, SnapshotThreaded> {
+        registry.reclaim();
+    }
+
+private:
+    struct Slot {
+        Creator create;
+        Base* (*construct)(void* storage, Args... args);
+        TypeLayout layout;
+        std::shared_ptr<Pool> pool;
+    };
+
+    struct Registry {
+        std::unordered_map<std::string, TypeHandle, StringHash, std::equal_to<>> handles;
+        std::vector<Slot> slots; // Dense, indexed by TypeHandle::index
+        std::vector<std::shared_ptr<Pool>> retiredPools;
+
+        const Slot* find(TypeHandle handle) const {
+            return handle.index < slots.size() ? &slots[handle.index] : nullptr;
+        }
+        const Slot* find(std::string_view key) const {
+            auto it = handles.find(key);
+            return it != handles.end() ? &slots[it->second.index] : nullptr;
+        }
+    };
+    Guarded<Registry, ThreadPolicy> registry;
+};
+
+/**
+ * @brief `Factory<Base, ThreadPolicy>` for default-constructed products, or
+ * `Factory<Base, Base(Args...), ThreadPolicy>` to construct products from arguments.
+ */
+template <typename Base, typename PolicyOrSignature = SingleThreaded, typename ThreadPolicy = SingleThreaded>
+class Factory : public BasicFactory<Base, PolicyOrSignature> {};
+
+template <typename Base, typename R, typename... Args, typename ThreadPolicy>
+class Factory<Base, R(Args...), ThreadPolicy> : public BasicFactory<Base, ThreadPolicy, Args...> {};
+
 } // namespace gofpp
@@ -0,0 +1,209 @@
+/**
+ * @file object_pool.hpp
+ * @author Noah G. Wood (@NoahGWood)
+ * @brief GoF++ Object Pool pattern implementation
+ * @details
+ * Hands out reusable objects instead of constructing and destroying them on every use.
+ * Objects stay constructed while pooled; an optional reset hook restores their state
+ * when they come back.
+ *
+ * @section features Key Features
+ * - Objects carved from fixed-size slabs (one allocation per `slabSize` objects).
+ * - Intrusive free list: no allocation when an object is returned.
+ * - Per-thread magazines under locking policies; objects may be returned from any thread.
+ * - RAII handles (`std::unique_ptr` with a pool deleter).
+ * - Optional reset hook run on every return.
+ *
+ * @section usage Example Usage
+ * ```cpp
+ * struct Packet { std::vector<char> bytes; };
+ *
+ * gofpp::ObjectPool<Packet, gofpp::MultiThreaded> packets(
+ *     64, [](Packet& p) { p.bytes.clear(); }); // Keeps capacity, drops contents
+ *
+ * {
+ *     auto p = packets.acquire();
+ *     p->bytes.push_back('x');
+ * } // Reset and returned to the pool here
+ * ```
+ *
+ * @section threading Threading
+ * - Default: `SingleThreaded` (no locking, no magazines).
+ * - Optional: `MultiThreaded` (each thread keeps a magazine of up to 32 objects and
+ *   only locks the shared free list when its magazine runs empty or full).
+ * - The pool must outlive every handle it has given out.
+ *
+ * @version 0.1
+ * @date 2025-08-05
+ * @copyright
+ * GPLv3 License - Copyright (c) 2025 Noah G. Wood
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include <gofpp/threading.hpp>
+
+namespace gofpp {
+
+namespace detail {
+
+// Per-thread magazines. A magazine only holds pointers; on eviction or thread exit its
+// objects go back to the pool if the pool still exists.
+struct Magazine {
+    std::weak_ptr<void> owner;
+    void (*giveBack)(void* owner, void** items, std::uint32_t count) = nullptr;
+
+    static void dispose(Magazine& m, void** items, std::uint32_t count) {
+        if (auto core = m.owner.lock()) m.giveBack(core.get(), items, count);
+    }
+};
+
+using MagazineCache = ThreadCache<Magazine>;
+
+} // namespace detail
+
+template <typename T, typename ThreadPolicy = SingleThreaded>
+class ObjectPool {
+    struct Core;
+
+public:
+    using ResetHook = std::function<void(T&)>;
+
+    /**
+     * @brief Returns an object to its pool instead of deleting it.
+     */
+    struct Deleter {
+        Core* core = nullptr;
+        void operator()(T* object) const { core->release(object); }
+    };
+    using Handle = std::unique_ptr<T, Deleter>;
+
+    explicit ObjectPool(std::size_t slabSize = 64, ResetHook reset = {})
+        : core(std::make_shared<Core>(slabSize ? slabSize : 1, std::move(reset))) {}
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // Reuses a pooled object, or default-constructs a new one in the current slab.
+    Handle acquire() { return Handle(core->acquire(), Deleter{core.get()}); }
+
+    // Objects constructed so far (live plus pooled).
+    std::size_t size() { return core->size(); }
+
+private:
+    struct Slot {
+        alignas(T) std::byte storage[sizeof(T)]; // First member: T* and Slot* share an address
+        Slot* next = nullptr;
+    };
+
+    using Lock = typename LockingPolicy<ThreadPolicy>::Lock;
+    static constexpr bool magazines = !std::is_same_v<ThreadPolicy, SingleThreaded>;
+
+    struct Core : private LockingPolicy<ThreadPolicy>, std::enable_shared_from_this<Core> {
+        Core(std::size_t slabSize, ResetHook reset) : slabSize(slabSize), reset(std::move(reset)) {}
+
+        ~Core() {
+            for (std::size_t s = 0; s < slabs.size(); ++s) {
+                std::size_t constructed = s + 1 == slabs.size() ? used : slabSize;
+                for (std::size_t i = 0; i < constructed; ++i) object(&slabs[s][i])->~T();
+                ::operator delete(slabs[s], slabSize * sizeof(Slot), std::align_val_t(alignof(Slot)));
+            }
+        }
+
+        T* acquire() {
+            if constexpr (magazines) {
+                auto& m = magazine();
+                if (m.count == 0) {
+                    Lock lock(*this);
+                    while (head && m.count < detail::MagazineCache::depth / 2) m.items[m.count++] = pop();
+                    if (m.count == 0) return carve();
+                }
+                return static_cast<T*>(m.items[--m.count]);
+            } else {
+                Lock lock(*this);
+                return head ? object(pop()) : carve();
+            }
+        }
+
+        void release(T* obj) {
+            if (reset) reset(*obj);
+            if constexpr (magazines) {
+                auto& m = magazine();
+                if (m.count == detail::MagazineCache::depth) {
+                    giveBack(m.items + m.count / 2, m.count - m.count / 2);
+                    m.count /= 2;
+                }
+                m.items[m.count++] = obj;
+            } else {
+                Lock lock(*this);
+                push(slot(obj));
+            }
+        }
+
+        std::size_t size() {
+            Lock lock(*this);
+            return slabs.empty() ? 0 : (slabs.size() - 1) * slabSize + used;
+        }
+
+    private:
+        static T* object(Slot* s) { return std::launder(reinterpret_cast<T*>(s->storage)); }
+        static Slot* slot(T* obj) { return reinterpret_cast<Slot*>(obj); }
+
+        // Caller holds the lock.
+        void push(Slot* s) {
+            s->next = head;
+            head = s;
+        }
+        Slot* pop() {
+            Slot* s = head;
+            head = s->next;
+            return s;
+        }
+
+        // Constructs a fresh object in the current slab; caller holds the lock.
+        T* carve() {
+            if (slabs.empty() || used == slabSize) {
+                slabs.push_back(static_cast<Slot*>(
+                    ::operator new(slabSize * sizeof(Slot), std::align_val_t(alignof(Slot)))));
+                used = 0;
+            }
+            Slot* s = ::new (&slabs.back()[used]) Slot;
+            T* obj = ::new (s->storage) T();
+            ++used; // Only after construction succeeded
+            return obj;
+        }
+
+        void giveBack(void** items, std::uint32_t n) {
+            Lock lock(*this);
+            for (std::uint32_t i = 0; i < n; ++i) push(slot(static_cast<T*>(items[i])));
+        }
+
+        // Claiming the bin hands another pool's objects back to it first.
+        detail::MagazineCache::Bin& magazine() {
+            return detail::MagazineCache::local().binFor(id, [&](detail::Magazine& m) {
+                m.owner = std::static_pointer_cast<void>(this->shared_from_this());
+                m.giveBack = [](void* owner, void** items, std::uint32_t n) {
+                    static_cast<Core*>(owner)->giveBack(items, n);
+                };
+            });
+        }
+
+        const std::size_t slabSize;
+        const ResetHook reset;
+        const std::uint64_t id = detail::MagazineCache::nextId();
+        std::vector<Slot*> slabs;
+        std::size_t used = 0; // Slots constructed in slabs.back()
+        Slot* head = nullptr;
+    };
+
+    std::shared_ptr<Core> core;
+};
+
+} // namespace gofpp
@@ -8,6 +8,10 @@
  * @section features Key Features
  * - Each prototype defines `clone()` returning `std::unique_ptr`.
  * - Useful for prefabs, templates, and runtime cloning.
+ * - `Cloneable<Derived, Base>` implements `clone()` plus placement cloning, which lets
+ *   `PolyValue<Base, InlineSize>` hold small clones inline with no heap allocation.
+ * - `PrototypeRegistry` hands out copy-on-write `CowPtr` clones that share the prototype
+ *   until their first `write()`, and reports how many bytes the sharing saved.
  *
  * @section usage Example Usage
  * ```cpp
@@ -24,8 +28,26 @@
  *
  * Circle c1;
  * auto c2 = c1.clone();
+ *
+ * struct Spawnable : gofpp::Prototype<Spawnable> { virtual int hp() const = 0; };
+ * struct Goblin : gofpp::Cloneable<Goblin, Spawnable> { int hp() const override { return 7; } };
+ *
+ * Goblin prefab;
+ * auto spawned = gofpp::PolyValue<Spawnable>::cloneOf(prefab); // Stored inline
+ * auto copy = spawned;                                         // Clones inline again
+ *
+ * gofpp::PrototypeRegistry<std::string, Mesh, gofpp::SharedMutexThreaded> meshes;
+ * meshes.add("rock", Mesh::load("rock.obj"));
+ * gofpp::CowPtr<Mesh> rock = meshes.clone("rock"); // No copy
+ * rock->draw();                                     // Reads the shared mesh
+ * rock.write().scale(2.0f);                         // First write detaches a private copy
  * ```
  *
+ * @section threading Threading
+ * - `PrototypeRegistry` takes a `ThreadPolicy` (`clone` uses the shared lock).
+ * - Shared payloads are never written; distinct `CowPtr`s may be used from any thread,
+ *   but a single `CowPtr` object must not be used by two threads at once.
+ *
  * @version 0.1
  * @date 2025-08-05
  * @copyright
@@ -33,7 +55,16 @@
  */
 
 #pragma once
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <gofpp/threading.hpp>
 
 namespace gofpp {
 
@@ -41,6 +72,255 @@ template <typename T>
 struct Prototype {
     virtual ~Prototype() = default;
     virtual std::unique_ptr<T> clone() const = 0;
+
+    // Copy- / move-construct the most-derived object into storage. Return nullptr when
+    // it does not fit or placement is unsupported; callers then fall back to clone().
+    // A type that cloneInto() places must also be placeable by moveInto(), which cannot throw.
+    virtual T* cloneInto(void*, std::size_t) const { return nullptr; }
+    virtual T* moveInto(void*, std::size_t) noexcept { return nullptr; }
+};
+
+/**
+ * @brief CRTP helper implementing `clone`, `cloneInto` and `moveInto` for `Derived`.
+ * `Base` must derive from `Prototype<Base>`.
+ */
+template <typename Derived, typename Base>
+struct Cloneable : Base {
+    using Base::Base;
+
+    std::unique_ptr<Base> clone() const override {
+        return std::make_unique<Derived>(self());
+    }
+
+    // Only nothrow-movable objects are placed, so a holder can always move them on.
+    Base* cloneInto(void* storage, std::size_t capacity) const override {
+        if constexpr (!std::is_nothrow_move_constructible_v<Derived>) return nullptr;
+        if (!std::align(alignof(Derived), sizeof(Derived), storage, capacity)) return nullptr;
+        return ::new (storage) Derived(self());
+    }
+
+    Base* moveInto(void* storage, std::size_t capacity) noexcept override {
+        if constexpr (!std::is_nothrow_move_constructible_v<Derived>) return nullptr;
+        if (!std::align(alignof(Derived), sizeof(Derived), storage, capacity)) return nullptr;
+        return ::new (storage) Derived(std::move(static_cast<Derived&>(*this)));
+    }
+
+private:
+    const Derived& self() const { return static_cast<const Derived&>(*this); }
+};
+
+/**
+ * @brief Value-semantic polymorphic holder: copies clone, small objects live inline.
+ * Objects that do not fit in `InlineSize` bytes, do not support placement cloning or
+ * may throw when moved are held on the heap instead, so moving a PolyValue never throws.
+ */
+template <typename T, std::size_t InlineSize = 64>
+class PolyValue {
+    static_assert(std::is_base_of_v<Prototype<T>, T>, "PolyValue requires T : Prototype<T>");
+
+public:
+    PolyValue() = default;
+
+    // Constructs Derived in place, inline when it fits.
+    template <typename Derived, typename... Args>
+    explicit PolyValue(std::in_place_type_t<Derived>, Args&&... args) {
+        static_assert(std::is_base_of_v<T, Derived>);
+        if constexpr (sizeof(Derived) <= InlineSize && alignof(Derived) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible_v<Derived>) {
+            ptr = ::new (static_cast<void*>(buffer)) Derived(std::forward<Args>(args)...);
+        } else {
+            ptr = new Derived(std::forward<Args>(args)...);
+        }
+    }
+
+    static PolyValue cloneOf(const T& prototype) {
+        PolyValue v;
+        v.assignClone(prototype);
+        return v;
+    }
+
+    PolyValue(const PolyValue& other) {
+        if (other.ptr) assignClone(*other.ptr);
+    }
+
+    PolyValue(PolyValue&& other) noexcept { steal(other); }
+
+    PolyValue& operator=(const PolyValue& other) {
+        if (this != &other) {
+            PolyValue copy(other);
+            reset();
+            steal(copy);
+        }
+        return *this;
+    }
+
+    PolyValue& operator=(PolyValue&& other) noexcept {
+        if (this != &other) {
+            reset();
+            steal(other);
+        }
+        return *this;
+    }
+
+    ~PolyValue() { reset(); }
+
+    T* get() const noexcept { return ptr; }
+    T& operator*() const noexcept { return *ptr; }
+    T* operator->() const noexcept { return ptr; }
+    explicit operator bool() const noexcept { return ptr != nullptr; }
+
+    bool isInline() const noexcept {
+        return ptr && static_cast<const void*>(ptr) >= static_cast<const void*>(buffer) &&
+               static_cast<const void*>(ptr) < static_cast<const void*>(buffer + InlineSize);
+    }
+
+    void reset() noexcept {
+        if (isInline()) ptr->~T();
+        else delete ptr;
+        ptr = nullptr;
+    }
+
+private:
+    void assignClone(const T& source) {
+        ptr = source.cloneInto(buffer, InlineSize);
+        if (!ptr) ptr = source.clone().release();
+    }
+
+    // Heap objects change owner; inline objects are moved into this buffer. Only
+    // nothrow-movable objects are ever inline, so moveInto() succeeds.
+    void steal(PolyValue& other) noexcept {
+        if (!other.ptr) return;
+        if (!other.isInline()) {
+            ptr = std::exchange(other.ptr, nullptr);
+            return;
+        }
+        ptr = other.ptr->moveInto(buffer, InlineSize);
+        other.reset();
+    }
+
+    alignas(std::max_align_t) std::byte buffer[InlineSize];
+    T* ptr = nullptr;
+};
+
+namespace detail {
+
+struct CowCounter {
+    std::atomic<std::int64_t> bytesSaved{0};
+};
+
+template <typename T>
+std::shared_ptr<T> deepCopy(const T& value) {
+    if constexpr (std::is_base_of_v<Prototype<T>, T>) return std::shared_ptr<T>(value.clone());
+    else return std::make_shared<T>(value);
+}
+
+template <typename T>
+std::size_t footprintOf(const T& value) {
+    if constexpr (requires { { value.byteSize() } -> std::convertible_to<std::size_t>; }) return value.byteSize();
+    else return sizeof(T);
+}
+
+} // namespace detail
+
+/**
+ * @brief Copy-on-write handle to a prototype payload.
+ * Reads go to the shared payload; `write()` detaches a private copy if it is shared.
+ */
+template <typename T>
+class CowPtr {
+public:
+    CowPtr() = default;
+
+    // A copy that still shares the prototype is one more deep copy avoided.
+    CowPtr(const CowPtr& other) : data(other.data), counter(other.counter), footprint(other.footprint) {
+        if (counter) counter->bytesSaved.fetch_add(static_cast<std::int64_t>(footprint), std::memory_order_relaxed);
+    }
+
+    CowPtr(CowPtr&&) noexcept = default;
+
+    CowPtr& operator=(CowPtr other) noexcept {
+        std::swap(data, other.data);
+        std::swap(counter, other.counter);
+        std::swap(footprint, other.footprint);
+        return *this; // other takes the old share with it
+    }
+
+    const T& operator*() const noexcept { return *data; }
+    const T* operator->() const noexcept { return data.get(); }
+    const T* get() const noexcept { return data.get(); }
+    explicit operator bool() const noexcept { return data != nullptr; }
+
+    bool isShared() const noexcept { return data.use_count() > 1; }
+
+    // Mutable access; deep-copies the payload first if anyone else can see it.
+    T& write() {
+        if (isShared()) {
+            data = detail::deepCopy<T>(*data);
+            if (counter) {
+                counter->bytesSaved.fetch_sub(static_cast<std::int64_t>(footprint), std::memory_order_relaxed);
+                counter.reset();
+            }
+        } else {
+            // use_count() is a relaxed load. The last other owner released its reads when it
+            // dropped its share; acquire them before writing in place.
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return *data;
+    }
+
+private:
+    template <typename, typename, typename>
+    friend class PrototypeRegistry;
+
+    CowPtr(std::shared_ptr<T> data, std::shared_ptr<detail::CowCounter> counter, std::size_t footprint)
+        : data(std::move(data)), counter(std::move(counter)), footprint(footprint) {}
+
+    std::shared_ptr<T> data;
+    std::shared_ptr<detail::CowCounter> counter; // Set while this clone still shares the prototype
+    std::size_t footprint = 0;
+};
+
+/**
+ * @brief Keyed registry of immutable prototypes handing out copy-on-write clones.
+ * `T` is cloned with `clone()` if it derives from `Prototype<T>`, else copy-constructed.
+ * A prototype's size defaults to `value.byteSize()` if present, else `sizeof(T)`.
+ */
+template <typename Key, typename T, typename ThreadPolicy = SingleThreaded>
+class PrototypeRegistry : private ThreadPolicy {
+public:
+    void add(const Key& key, std::unique_ptr<T> prototype, std::size_t footprint = 0) {
+        if (footprint == 0) footprint = detail::footprintOf(*prototype);
+        typename ThreadPolicy::Lock lock(*this);
+        entries.insert_or_assign(key, Entry{std::shared_ptr<T>(std::move(prototype)), footprint});
+    }
+
+    template <typename Derived>
+    void add(const Key& key, Derived prototype, std::size_t footprint = 0) {
+        add(key, std::unique_ptr<T>(std::make_unique<Derived>(std::move(prototype))), footprint);
+    }
+
+    // Shares the prototype; returns an empty handle for unknown keys.
+    CowPtr<T> clone(const Key& key) {
+        typename ThreadPolicy::SharedLock lock(*this);
+        auto it = entries.find(key);
+        if (it == entries.end()) return {};
+        counter->bytesSaved.fetch_add(static_cast<std::int64_t>(it->second.footprint), std::memory_order_relaxed);
+        return CowPtr<T>(it->second.payload, counter, it->second.footprint);
+    }
+
+    // Bytes of deep copies avoided so far: clones handed out minus clones since detached.
+    std::int64_t bytesSaved() const noexcept {
+        return counter->bytesSaved.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Entry {
+        std::shared_ptr<T> payload;
+        std::size_t footprint;
+    };
+
+    std::unordered_map<Key, Entry> entries;
+    std::shared_ptr<detail::CowCounter> counter = std::make_shared<detail::CowCounter>();
 };
 
 } // namespace gofpp
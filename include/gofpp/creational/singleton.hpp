@@ -15,8 +15,44 @@
  * Logger::Instance().log("Hello!");
  * ```
  *
+ * ## Managed singletons
+ * `SingletonRegistry` builds singletons at an explicit startup point instead of on first
+ * use. Each declares its dependencies; independent ones are built in parallel, and all
+ * are destroyed in reverse order at shutdown. Between the two, `ManagedSingleton<T>::Instance()`
+ * is a plain pointer load with no initialization guard.
+ * ```cpp
+ * struct Config : gofpp::ManagedSingleton<Config> { ... };
+ * struct Database : gofpp::ManagedSingleton<Database> {
+ *     Database() : url(Config::Instance().dbUrl()) {} // Config is already built
+ * };
+ *
+ * gofpp::SingletonRegistry services;
+ * services.add<Config>().add<Logger>().add<Database, Config, Logger>();
+ * services.startup();   // Config and Logger in parallel, then Database
+ * Database::Instance().query("...");
+ * services.shutdown();  // Database, then Logger and Config
+ * ```
+ *
+ * ## Per-thread and sharded singletons
+ * For counters, caches and scratch allocators a single global instance is a contention
+ * hotspot. `ThreadLocalSingleton<T>` gives every thread its own instance;
+ * `ShardedSingleton<T, N>` keeps N cache-line-padded instances, picks one per thread
+ * (or per CPU) and aggregates with `forEachShard`.
+ * ```cpp
+ * struct Hits { std::atomic<long> n{0}; };
+ * using HitCounter = gofpp::ShardedSingleton<Hits, 16>;
+ *
+ * HitCounter::Local().n.fetch_add(1, std::memory_order_relaxed); // Mostly uncontended
+ * long total = 0;
+ * HitCounter::forEachShard([&](Hits& h) { total += h.n.load(); });
+ * ```
+ *
  * ## Threading
  * Use `SingleThreaded` (default) or `MultiThreaded` policy.
+ * A shard may be shared by several threads (more threads than shards, or CPU
+ * sharding), so `ShardedSingleton` shard types must be thread-safe themselves.
+ * Managed singletons may be read from any thread started after `startup()` returns,
+ * and must not be used after `shutdown()`. They are not resurrected: a later `startup()` throws.
  * 
  * @version 0.1
  * @date 2025-08-05
@@ -25,7 +61,18 @@
  */
 
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
 #include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 #include <gofpp/threading.hpp>
 namespace gofpp
@@ -46,4 +93,215 @@ namespace gofpp
         ~Singleton() = default;
     };
 
+    /**
+     * @brief Singleton whose lifetime is owned by a `SingletonRegistry`.
+     * `Instance()` is valid between the registry's `startup()` and `shutdown()`.
+     */
+    template <typename T>
+    class ManagedSingleton {
+    public:
+        static T& Instance() noexcept { return *instance; }
+        static bool IsAlive() noexcept { return instance != nullptr; }
+
+    private:
+        friend class SingletonRegistry;
+        static inline T* instance = nullptr; // Constant-initialized: no guard on access
+    };
+
+    /**
+     * @brief Builds managed singletons in dependency order and tears them down in reverse.
+     */
+    class SingletonRegistry {
+    public:
+        SingletonRegistry() = default;
+        ~SingletonRegistry() { shutdown(); }
+
+        SingletonRegistry(const SingletonRegistry&) = delete;
+        SingletonRegistry& operator=(const SingletonRegistry&) = delete;
+
+        // Declares T, built after every type in Deps (which must also be declared).
+        template <typename T, typename... Deps>
+        SingletonRegistry& add() {
+            entries.push_back(Entry{key<T>(), {key<Deps>()...}, &construct<T>, &destroy<T>});
+            return *this;
+        }
+
+        // Builds every declared singleton. Entries whose dependencies are all built run in
+        // parallel on up to `threads` threads (0 = hardware concurrency). Throws
+        // std::logic_error on duplicates, unknown dependencies or cycles, or after shutdown();
+        // if a constructor throws, everything built so far is destroyed and the exception is rethrown.
+        void startup(unsigned threads = 0) {
+            if (stopped) throw std::logic_error("SingletonRegistry: startup() after shutdown()");
+            if (!built.empty()) return;
+            if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+            try {
+                for (auto& level : levels()) buildLevel(level, threads);
+            } catch (...) {
+                teardown();
+                throw;
+            }
+        }
+
+        // Destroys in reverse construction order; dependents go before their dependencies.
+        // Final: the singletons are never rebuilt.
+        void shutdown() noexcept {
+            stopped = true;
+            teardown();
+        }
+
+        bool started() const noexcept { return !built.empty(); }
+
+    private:
+        using Key = const void*;
+
+        struct Entry {
+            Key key;
+            std::vector<Key> deps;
+            void (*construct)();
+            void (*destroy)();
+        };
+
+        template <typename T>
+        static Key key() { return &ManagedSingleton<T>::instance; }
+
+        void teardown() noexcept {
+            while (!built.empty()) {
+                entries[built.back()].destroy();
+                built.pop_back();
+            }
+        }
+
+        template <typename T>
+        static void construct() { ManagedSingleton<T>::instance = new T(); }
+
+        template <typename T>
+        static void destroy() { delete std::exchange(ManagedSingleton<T>::instance, nullptr); }
+
+        std::size_t indexOf(Key k) const {
+            for (std::size_t i = 0; i < entries.size(); ++i)
+                if (entries[i].key == k) return i;
+            throw std::logic_error("SingletonRegistry: dependency was never added");
+        }
+
+        // Kahn's algorithm, grouped so each level depends only on earlier levels.
+        std::vector<std::vector<std::size_t>> levels() const {
+            const std::size_t n = entries.size();
+            std::vector<std::size_t> pending(n, 0);
+            std::vector<std::vector<std::size_t>> dependents(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                if (indexOf(entries[i].key) != i) throw std::logic_error("SingletonRegistry: type added twice");
+                for (Key d : entries[i].deps) {
+                    dependents[indexOf(d)].push_back(i);
+                    ++pending[i];
+                }
+            }
+
+            std::vector<std::vector<std::size_t>> out;
+            std::vector<std::size_t> ready;
+            for (std::size_t i = 0; i < n; ++i)
+                if (pending[i] == 0) ready.push_back(i);
+            std::size_t placed = 0;
+            while (!ready.empty()) {
+                placed += ready.size();
+                std::vector<std::size_t> next;
+                for (std::size_t i : ready)
+                    for (std::size_t d : dependents[i])
+                        if (--pending[d] == 0) next.push_back(d);
+                out.push_back(std::move(ready));
+                ready = std::move(next);
+            }
+            if (placed != n) throw std::logic_error("SingletonRegistry: dependency cycle");
+            return out;
+        }
+
+        void buildLevel(const std::vector<std::size_t>& level, unsigned threads) {
+            std::vector<char> done(level.size(), 0);
+            std::atomic<std::size_t> next{0};
+            std::exception_ptr error;
+            std::mutex errorMutex;
+
+            auto worker = [&] {
+                for (std::size_t i; (i = next.fetch_add(1)) < level.size();) {
+                    try {
+                        entries[level[i]].construct();
+                        done[i] = 1;
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(errorMutex);
+                        if (!error) error = std::current_exception();
+                    }
+                }
+            };
+
+            std::vector<std::thread> helpers;
+            std::size_t extra = std::min<std::size_t>(threads, level.size()) - 1;
+            for (std::size_t t = 0; t < extra; ++t) helpers.emplace_back(worker);
+            worker();
+            for (auto& h : helpers) h.join();
+
+            for (std::size_t i = 0; i < level.size(); ++i)
+                if (done[i]) built.push_back(level[i]);
+            if (error) std::rethrow_exception(error);
+        }
+
+        std::vector<Entry> entries;
+        std::vector<std::size_t> built; // Construction order
+        bool stopped = false;           // shutdown() ran: startup() is refused
+    };
+
+    /**
+     * @brief One instance of T per thread, created on first use in that thread.
+     */
+    template <typename T>
+    class ThreadLocalSingleton {
+    public:
+        static T& Instance() {
+            thread_local T instance;
+            return instance;
+        }
+    };
+
+    // How ShardedSingleton picks the calling thread's shard.
+    enum class ShardBy {
+        Thread, // Stable round-robin index per thread
+        Cpu     // Current CPU where available (Linux), else Thread
+    };
+
+    /**
+     * @brief N instances of T, each padded to its own cache line(s).
+     */
+    template <typename T, std::size_t N = 16, ShardBy By = ShardBy::Thread>
+    class ShardedSingleton {
+        static_assert(N > 0, "ShardedSingleton needs at least one shard");
+
+    public:
+        static constexpr std::size_t shardCount = N;
+
+        static T& Local() noexcept { return shards[index() % N].value; }
+        static T& Shard(std::size_t i) noexcept { return shards[i].value; }
+
+        template <typename Fn>
+        static void forEachShard(Fn&& fn) {
+            for (auto& s : shards) fn(s.value);
+        }
+
+    private:
+        struct alignas(cacheLineSize) Padded {
+            T value{};
+        };
+
+        static std::size_t index() noexcept {
+#if defined(__linux__)
+            if constexpr (By == ShardBy::Cpu) {
+                int cpu = sched_getcpu();
+                if (cpu >= 0) return static_cast<std::size_t>(cpu);
+            }
+#endif
+            static std::atomic<std::size_t> next{0};
+            thread_local std::size_t mine = next.fetch_add(1, std::memory_order_relaxed);
+            return mine;
+        }
+
+        static inline Padded shards[N]{};
+    };
+
 } // namespace gofpp
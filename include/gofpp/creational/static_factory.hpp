@@ -0,0 +1,262 @@
+/**
+ * @file static_factory.hpp
+ * @author Noah G. Wood (@NoahGWood)
+ * @brief GoF++ compile-time Factory variant
+ * @details
+ * A Factory whose registry is fixed at compile time. The keys are turned into a
+ * perfect hash table during compilation, so a lookup is one hash, one displacement
+ * read, one string compare and a direct call. There is no runtime registration
+ * and no `std::function`.
+ *
+ * @section features Key Features
+ * - Keys and products declared as `Entry<"key", Derived>` template arguments.
+ * - Collision-free hash table built at compile time by hash-and-displace (one
+ *   small displacement per pair of keys), so large key sets build quickly.
+ * - Stateless and `constexpr`-constructible: usable as a `constinit` global.
+ * - `create<"key">()` resolves entirely at compile time.
+ *
+ * @section usage Example Usage
+ * ```cpp
+ * struct Shape { virtual ~Shape() = default; virtual int sides() const = 0; };
+ * struct Circle : Shape { int sides() const override { return 0; } };
+ * struct Square : Shape { int sides() const override { return 4; } };
+ *
+ * constinit gofpp::StaticFactory<Shape,
+ *     gofpp::Entry<"circle", Circle>,
+ *     gofpp::Entry<"square", Square>> shapes;
+ *
+ * auto s = shapes.create("square");      // Runtime key, perfect-hash lookup
+ * auto c = shapes.create<"circle">();    // Compile-time key, no lookup at all
+ * ```
+ *
+ * @section threading Threading
+ * The table is immutable, so `create` is safe from any thread without a policy.
+ *
+ * @version 0.1
+ * @date 2025-08-05
+ * @copyright
+ * GPLv3 License - Copyright (c) 2025 Noah G. Wood
+ */
+
+#pragma once
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+
+namespace gofpp {
+
+/**
+ * @brief String literal usable as a template argument.
+ */
+template <std::size_t N>
+struct FixedString {
+    char data[N]{};
+
+    constexpr FixedString(const char (&s)[N]) {
+        for (std::size_t i = 0; i < N; ++i) data[i] = s[i];
+    }
+    constexpr std::string_view view() const { return {data, N - 1}; }
+};
+
+/**
+ * @brief Binds a compile-time key to a concrete product type.
+ */
+template <FixedString Key, typename Derived>
+struct Entry {
+    static constexpr std::string_view key = Key.view();
+    using type = Derived;
+};
+
+namespace detail {
+
+// Little-endian load of up to 8 bytes, byte by byte. Used during constant evaluation,
+// where the table is built; run-time lookups use the word loads below, which agree with it.
+constexpr std::uint64_t loadWord(const char* p, std::size_t n) {
+    std::uint64_t w = 0;
+    for (std::size_t i = 0; i < n; ++i) w |= std::uint64_t(static_cast<unsigned char>(p[i])) << (8 * i);
+    return w;
+}
+
+inline constexpr bool nativeLittleEndian = std::endian::native == std::endian::little;
+
+template <typename Word>
+Word loadNative(const char* p) {
+    Word w;
+    std::memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+constexpr std::uint64_t load8(const char* p) {
+    if (!std::is_constant_evaluated() && nativeLittleEndian) return loadNative<std::uint64_t>(p);
+    return loadWord(p, 8);
+}
+
+// The last s.size() - i (< 8) bytes of s, as loadWord reads them. At run time this is
+// one overlapping load for keys of 8 bytes or more, two for 4..7 bytes.
+constexpr std::uint64_t loadTail(std::string_view s, std::size_t i) {
+    std::size_t n = s.size() - i;
+    if (n == 0) return 0;
+    if (!std::is_constant_evaluated() && nativeLittleEndian) {
+        if (s.size() >= 8) return loadNative<std::uint64_t>(s.data() + s.size() - 8) >> (8 * (8 - n));
+        if (n >= 4) { // i == 0: the key is 4..7 bytes; the two loads overlap
+            return loadNative<std::uint32_t>(s.data()) |
+                   std::uint64_t(loadNative<std::uint32_t>(s.data() + n - 4)) << (8 * (n - 4));
+        }
+    }
+    return loadWord(s.data() + i, n);
+}
+
+// Murmur3 finalizer: every input bit affects every output bit.
+constexpr std::uint64_t avalanche(std::uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    return h ^ (h >> 33);
+}
+
+// Word-at-a-time multiplicative hash with a full final mix, so the low bits used
+// for slots depend on every byte of the key.
+constexpr std::uint64_t keyHash(std::string_view s) {
+    constexpr std::uint64_t k = 0x9E3779B97F4A7C15ull;
+    std::uint64_t h = s.size() * k;
+    std::size_t i = 0;
+    for (; i + 8 <= s.size(); i += 8) {
+        h = (h ^ load8(s.data() + i)) * k;
+        h ^= h >> 32;
+    }
+    return avalanche(h ^ loadTail(s, i));
+}
+
+// Hash and displace: keys are split into buckets by the high hash bits, and each
+// bucket gets its own displacement that moves its keys into free slots. Buckets are
+// placed largest first while the table is emptiest, so the search stays linear in N.
+template <std::size_t N>
+struct PerfectHash {
+    static constexpr std::uint8_t empty = 0xFF;
+    static constexpr std::size_t bucketCount = (N + 1) / 2;
+    static constexpr std::size_t slotCount = std::bit_ceil(2 * N); // Load factor <= 1/2
+
+    std::array<std::uint16_t, bucketCount> displacement{};
+    std::array<std::uint8_t, slotCount> slots{}; // Slot -> entry index
+    bool uniqueKeys = true; // Equal keys share a bucket, so they are found while placing it
+
+    constexpr explicit PerfectHash(const std::array<std::string_view, N>& keys) {
+        slots.fill(empty);
+        std::array<std::uint64_t, N> hashes{};
+        std::array<std::size_t, bucketCount + 1> first{}; // Bucket b's keys are members[first[b], first[b + 1])
+        for (std::size_t i = 0; i < N; ++i) {
+            hashes[i] = keyHash(keys[i]);
+            ++first[bucketOf(hashes[i]) + 1];
+        }
+        std::size_t largest = 0;
+        for (std::size_t b = 0; b < bucketCount; ++b) {
+            largest = first[b + 1] > largest ? first[b + 1] : largest;
+            first[b + 1] += first[b];
+        }
+        std::array<std::size_t, N> members{};
+        std::array<std::size_t, bucketCount> filled{};
+        for (std::size_t i = 0; i < N; ++i) {
+            std::size_t b = bucketOf(hashes[i]);
+            members[first[b] + filled[b]++] = i;
+        }
+
+        for (std::size_t b = 0; b < bucketCount; ++b) {
+            for (std::size_t i = first[b]; i < first[b + 1]; ++i)
+                for (std::size_t j = i + 1; j < first[b + 1]; ++j)
+                    if (keys[members[i]] == keys[members[j]]) uniqueKeys = false;
+        }
+        if (!uniqueKeys) return;
+
+        for (std::size_t size = largest; size > 0; --size) {
+            for (std::size_t b = 0; b < bucketCount; ++b) {
+                if (first[b + 1] - first[b] == size && !place(hashes, members.data() + first[b], size, b)) {
+                    throw "gofpp::StaticFactory: no perfect hash found"; // Not a constant expression
+                }
+            }
+        }
+    }
+
+    constexpr std::size_t find(std::string_view key) const {
+        std::uint64_t h = keyHash(key);
+        return slots[slotOf(h, displacement[bucketOf(h)])];
+    }
+
+private:
+    static constexpr std::size_t bucketOf(std::uint64_t h) { return ((h >> 32) * bucketCount) >> 32; }
+
+    // Reuses the key hash: one multiply, with the slot taken from the product's top bits,
+    // which depend on every bit of h ^ displacement. No second avalanche per lookup.
+    static constexpr std::size_t slotOf(std::uint64_t h, std::uint16_t d) {
+        constexpr int shift = 64 - std::countr_zero(slotCount);
+        return ((h ^ (d * 0x9E3779B97F4A7C15ull)) * 0xD6E8FEB86659FD93ull) >> shift;
+    }
+
+    // Finds the first displacement that puts every key of bucket b into a free slot.
+    constexpr bool place(const std::array<std::uint64_t, N>& hashes, const std::size_t* keys, std::size_t size,
+                         std::size_t b) {
+        for (std::uint32_t d = 0; d <= 0xFFFF; ++d) {
+            std::size_t placed = 0;
+            while (placed < size) {
+                auto& slot = slots[slotOf(hashes[keys[placed]], static_cast<std::uint16_t>(d))];
+                if (slot != empty) break;
+                slot = static_cast<std::uint8_t>(keys[placed++]);
+            }
+            if (placed == size) {
+                displacement[b] = static_cast<std::uint16_t>(d);
+                return true;
+            }
+            while (placed > 0) slots[slotOf(hashes[keys[--placed]], static_cast<std::uint16_t>(d))] = empty;
+        }
+        return false;
+    }
+};
+
+} // namespace detail
+
+template <typename Base, typename... Entries>
+class StaticFactory {
+    static constexpr std::size_t count = sizeof...(Entries);
+    static_assert(count > 0 && count < 0xFF, "StaticFactory supports 1..254 entries");
+
+    static constexpr std::array<std::string_view, count> keys{Entries::key...};
+
+    static constexpr detail::PerfectHash<count> table{keys};
+    static_assert(table.uniqueKeys, "StaticFactory keys must be unique");
+
+    using Creator = std::unique_ptr<Base> (*)();
+    static constexpr std::array<Creator, count> creators{
+        []() -> std::unique_ptr<Base> { return std::make_unique<typename Entries::type>(); }...};
+
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    constexpr StaticFactory() = default;
+
+    // Index of key in the entry list, or npos.
+    static constexpr std::size_t indexOf(std::string_view key) {
+        std::size_t i = table.find(key);
+        return (i < count && keys[i] == key) ? i : npos;
+    }
+
+    static constexpr bool contains(std::string_view key) { return indexOf(key) != npos; }
+
+    std::unique_ptr<Base> create(std::string_view key) const {
+        std::size_t i = indexOf(key);
+        return i != npos ? creators[i]() : nullptr;
+    }
+
+    template <FixedString Key>
+    std::unique_ptr<Base> create() const {
+        constexpr std::size_t i = indexOf(Key.view());
+        static_assert(i != npos, "StaticFactory: unknown key");
+        return creators[i]();
+    }
+};
+
+} // namespace gofpp
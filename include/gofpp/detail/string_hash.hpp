@@ -0,0 +1,17 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+namespace gofpp
+{
+    /**
+     * @brief Transparent string hash enabling `std::string_view` lookups in string-keyed maps.
+     */
+    struct StringHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view s) const noexcept {
+            return std::hash<std::string_view>{}(s);
+        }
+    };
+} // namespace gofpp
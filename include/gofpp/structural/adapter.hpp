@@ -8,6 +8,7 @@
  * @section features Key Features
  * - Adapts incompatible APIs without modifying existing code.
  * - Supports both class and object adapters.
+ * - `InlineAdapter`: value-type adapter with inline storage and a compile-time vtable.
  *
  * @section usage Example Usage
  * ```cpp
@@ -21,6 +22,30 @@
  * };
  * ```
  *
+ * @section inline Non-allocating adapter
+ * `IAdapter` needs one heap object (and a virtual call) per wrapped object.
+ * `InlineAdapter<Interface, Size>` is a value type instead: the adaptee lives in a
+ * fixed `Size`-byte buffer (too-large adaptees fail to compile, so wrapping never
+ * allocates) and the target interface is a struct of function pointers, filled in at
+ * compile time for each adaptee type (`adapterVTable<Interface, Adaptee>`).
+ * ```cpp
+ * struct Renderer {                                    // Target interface
+ *     void (*draw)(void* self, int layer);
+ * };
+ * template <>
+ * inline constexpr Renderer gofpp::adapterVTable<Renderer, LegacyRenderer>{
+ *     [](void* self, int layer) { static_cast<LegacyRenderer*>(self)->oldDraw(layer); }};
+ *
+ * gofpp::InlineAdapter<Renderer, 32> r(LegacyRenderer{...});
+ * r.call(&Renderer::draw, 2);                          // One indirect call
+ * ```
+ * An interface may instead provide `template <typename A> static constexpr Interface bind()`,
+ * used for every adaptee that has no explicit `adapterVTable` specialization.
+ *
+ * Adaptees must be nothrow-move-constructible. `InlineAdapter` is copyable and then only
+ * accepts copyable adaptees; `InlineAdapter<Interface, Size, false>` is move-only and
+ * accepts any of them. Both are checked at compile time.
+ *
  * @version 0.1
  * @date 2025-08-05
  * @copyright
@@ -28,6 +53,10 @@
  */
 
 #pragma once
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace gofpp {
 
@@ -41,4 +70,127 @@ public:
     virtual Target& getAdapted() = 0;
 };
 
+// How Adaptee implements Interface. Specialize per adaptee, or give Interface a bind<A>().
+template <typename Interface, typename Adaptee>
+inline constexpr Interface adapterVTable = Interface::template bind<Adaptee>();
+
+namespace detail {
+
+// Interface entries plus the lifetime operations, one static instance per adaptee type.
+template <typename Interface>
+struct AdapterTable {
+    Interface target;
+    void (*destroy)(void* self) noexcept;
+    void (*move)(void* to, void* from) noexcept; // Move-constructs, then destroys from
+    void (*copy)(void* to, const void* from);    // nullptr for move-only adapters
+};
+
+template <typename Interface, typename A, bool Copyable>
+inline constexpr AdapterTable<Interface> adapterTable{
+    adapterVTable<Interface, A>,
+    [](void* self) noexcept { static_cast<A*>(self)->~A(); },
+    [](void* to, void* from) noexcept {
+        ::new (to) A(std::move(*static_cast<A*>(from)));
+        static_cast<A*>(from)->~A();
+    },
+    [] {
+        if constexpr (Copyable) {
+            return +[](void* to, const void* from) { ::new (to) A(*static_cast<const A*>(from)); };
+        } else {
+            return static_cast<void (*)(void*, const void*)>(nullptr);
+        }
+    }(),
+};
+
+} // namespace detail
+
+template <typename Interface, std::size_t Size = 32, bool Copyable = true>
+class InlineAdapter {
+public:
+    InlineAdapter() = default;
+
+    template <typename A, typename = std::enable_if_t<!std::is_same_v<std::decay_t<A>, InlineAdapter>>>
+    InlineAdapter(A&& adaptee) {
+        emplace<std::decay_t<A>>(std::forward<A>(adaptee));
+    }
+
+    template <typename A, typename... Args>
+    explicit InlineAdapter(std::in_place_type_t<A>, Args&&... args) {
+        emplace<A>(std::forward<Args>(args)...);
+    }
+
+    InlineAdapter(const InlineAdapter& other) requires Copyable {
+        if (!other.table) return;
+        other.table->copy(buffer, other.buffer);
+        table = other.table;
+    }
+
+    InlineAdapter(InlineAdapter&& other) noexcept { steal(other); }
+
+    InlineAdapter& operator=(const InlineAdapter& other) requires Copyable {
+        if (this != &other) {
+            InlineAdapter copy(other);
+            reset();
+            steal(copy);
+        }
+        return *this;
+    }
+
+    InlineAdapter& operator=(InlineAdapter&& other) noexcept {
+        if (this != &other) {
+            reset();
+            steal(other);
+        }
+        return *this;
+    }
+
+    ~InlineAdapter() { reset(); }
+
+    // Replaces the adaptee with an A constructed in the buffer.
+    template <typename A, typename... Args>
+    A& emplace(Args&&... args) {
+        static_assert(sizeof(A) <= Size && alignof(A) <= alignof(std::max_align_t),
+                      "InlineAdapter: adaptee does not fit the inline buffer; raise Size");
+        static_assert(std::is_nothrow_move_constructible_v<A>, "InlineAdapter: adaptee moves must not throw");
+        static_assert(!Copyable || std::is_copy_constructible_v<A>,
+                      "InlineAdapter: adaptee is not copyable; use InlineAdapter<Interface, Size, false>");
+        reset();
+        A* a = ::new (static_cast<void*>(buffer)) A(std::forward<Args>(args)...);
+        table = &detail::adapterTable<Interface, A, Copyable>;
+        return *a;
+    }
+
+    // Calls an interface entry on the adaptee: one load and one indirect call.
+    template <typename R, typename... Params, typename... Args>
+    R call(R (*Interface::*entry)(void*, Params...), Args&&... args) {
+        return (table->target.*entry)(buffer, std::forward<Args>(args)...);
+    }
+
+    const Interface& vtable() const { return table->target; }
+    void* self() noexcept { return buffer; }
+
+    // The adaptee if it is an A, else nullptr.
+    template <typename A>
+    A* getAdapted() noexcept {
+        return table == &detail::adapterTable<Interface, A, Copyable> ? std::launder(reinterpret_cast<A*>(buffer)) : nullptr;
+    }
+
+    explicit operator bool() const noexcept { return table != nullptr; }
+
+    void reset() noexcept {
+        if (table) table->destroy(buffer);
+        table = nullptr;
+    }
+
+private:
+    void steal(InlineAdapter& other) noexcept {
+        if (!other.table) return;
+        other.table->move(buffer, other.buffer);
+        table = std::exchange(other.table, nullptr);
+    }
+
+    const detail::AdapterTable<Interface>* table = nullptr;
+    alignas(std::max_align_t) std::byte buffer[Size];
+};
+
 } // namespace gofpp
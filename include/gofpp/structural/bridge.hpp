@@ -8,6 +8,7 @@
  * @section features Key Features
  * - Abstraction holds pointer to implementation interface.
  * - Swap implementations at runtime (mock, real, different APIs).
+ * - `VariantBridge`: inline storage and `std::visit` dispatch for a closed set of backends.
  *
  * @section usage Example Usage
  * ```cpp
@@ -28,6 +29,43 @@
  * };
  * ```
  *
+ * @section variant Closed set of implementations
+ * When every backend is known at compile time, `VariantBridge<ImplA, ImplB, ...>` stores
+ * the active one inline in a `std::variant` and dispatches with `std::visit`: no heap
+ * pointer, no virtual call, and the backends need no common base class.
+ * ```cpp
+ * struct GL { int draw() { ... } };
+ * struct Vulkan { int draw() { ... } };
+ *
+ * class Renderer : public gofpp::VariantBridge<GL, Vulkan> {
+ * public:
+ *     int render() { return visit([](auto& backend) { return backend.draw(); }); }
+ * };
+ *
+ * Renderer r;                 // Starts with GL
+ * r.setImpl<Vulkan>();        // Switch at runtime, constructed in place
+ * ```
+ *
+ * @section threading Threading
+ * - Default: `SingleThreaded` (no synchronization; do not swap while others call).
+ * - Optional: `SnapshotThreaded` (hot-swap under concurrent callers). Calls go through
+ *   `pin()`, which marks the calling thread as reading (a store to a slot only that thread
+ *   writes) and loads the current implementation once; no lock and no shared write.
+ *   On Linux, writers issue `membarrier()` so readers need no fence instruction.
+ *   `setImpl` publishes the new implementation atomically, then waits until every call
+ *   that might still see the old one has finished before destroying it.
+ * ```cpp
+ * class Renderer : public gofpp::Bridge<RendererImpl, gofpp::SnapshotThreaded> {
+ * public:
+ *     using Bridge::Bridge;
+ *     void render() { pin()->draw(); } // Old backend stays alive until draw() returns
+ * };
+ *
+ * renderer.setImpl(std::make_unique<VulkanRenderer>()); // From any thread
+ * ```
+ * A `setImpl` from inside a pinned call cannot wait for itself; the old implementation
+ * is then kept until the next `setImpl` or `reclaim()` made outside a call.
+ *
  * @version 0.1
  * @date 2025-08-05
  * @copyright
@@ -35,17 +73,104 @@
  */
 
 #pragma once
+#include <atomic>
 #include <memory>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <gofpp/threading.hpp>
 
 namespace gofpp {
 
-template <typename Impl>
+template <typename Impl, typename ThreadPolicy = SingleThreaded>
 class Bridge {
+    static_assert(std::is_same_v<ThreadPolicy, SingleThreaded>, "Bridge supports SingleThreaded or SnapshotThreaded");
+
 public:
     explicit Bridge(std::unique_ptr<Impl> impl) : impl(std::move(impl)) {}
     void setImpl(std::unique_ptr<Impl> newImpl) { impl = std::move(newImpl); }
 protected:
+    Impl* pin() const { return impl.get(); }
+
     std::unique_ptr<Impl> impl;
 };
 
+template <typename Impl>
+class Bridge<Impl, SnapshotThreaded> {
+public:
+    /**
+     * @brief Keeps the implementation it points to alive while in scope.
+     */
+    class Pin {
+    public:
+        Pin(const Pin&) = delete;
+        Pin& operator=(const Pin&) = delete;
+
+        Impl* operator->() const { return impl; }
+        Impl& operator*() const { return *impl; }
+        Impl* get() const { return impl; }
+
+    private:
+        friend class Bridge;
+
+        explicit Pin(const std::atomic<Impl*>& current) : impl(current.load(std::memory_order_acquire)) {}
+
+        detail::ReadSection section; // Entered before impl is loaded
+        Impl* impl;
+    };
+
+    explicit Bridge(std::unique_ptr<Impl> impl) : current(impl.release()) {}
+
+    // No call may be in flight.
+    ~Bridge() { delete current.load(std::memory_order_relaxed); }
+
+    Bridge(const Bridge&) = delete;
+    Bridge& operator=(const Bridge&) = delete;
+
+    // Publishes newImpl, then destroys the old one once no call can still be using it.
+    void setImpl(std::unique_ptr<Impl> newImpl) {
+        retired.retire(std::unique_ptr<Impl>(current.exchange(newImpl.release(), std::memory_order_acq_rel)));
+    }
+
+    // Destroys implementations retired by a setImpl that could not wait.
+    void reclaim() { retired.reclaim(); }
+
+protected:
+    Pin pin() const { return Pin(current); }
+
+private:
+    std::atomic<Impl*> current;
+    detail::RetireList<Impl> retired;
+};
+
+template <typename... Impls>
+class VariantBridge {
+    static_assert(sizeof...(Impls) > 0, "VariantBridge needs at least one implementation");
+
+public:
+    // Starts with the first implementation, default-constructed.
+    VariantBridge() = default;
+
+    template <typename Impl, typename... Args>
+    explicit VariantBridge(std::in_place_type_t<Impl> type, Args&&... args) : impl(type, std::forward<Args>(args)...) {}
+
+    // Destroys the active implementation and constructs Impl in its place.
+    template <typename Impl, typename... Args>
+    Impl& setImpl(Args&&... args) {
+        return impl.template emplace<Impl>(std::forward<Args>(args)...);
+    }
+
+    template <typename Impl>
+    bool holds() const { return std::holds_alternative<Impl>(impl); }
+
+protected:
+    template <typename Fn>
+    decltype(auto) visit(Fn&& fn) { return std::visit(std::forward<Fn>(fn), impl); }
+
+    template <typename Fn>
+    decltype(auto) visit(Fn&& fn) const { return std::visit(std::forward<Fn>(fn), impl); }
+
+    std::variant<Impls...> impl;
+};
+
 } // namespace gofpp
@@ -6,8 +6,11 @@
  * Allows tree structures (e.g., scene graphs) where components and composites are treated uniformly.
  *
  * @section features Key Features
- * - Hierarchical parent/child relationships.
+ * - Hierarchical parent/child relationships with parent back-pointers.
+ * - O(1) child removal; optional O(1) child lookup by key (`KeyedComposite`).
  * - Recursive `operation()` for tree traversal.
+ * - `FlatComposite`: depth-first array traversal for large trees, rebuilt lazily.
+ * - Dirty tracking: `update()` recomputes only what changed (`AggregateComposite`).
  * - Ideal for ECS entities or UI widget trees.
  *
  * @section usage Example Usage
@@ -22,6 +25,53 @@
  * parent.operation(); // Calls child.operation() recursively
  * ```
  *
+ * @section flat Flat traversal
+ * Recursing through `children` chases one pointer per level and makes one virtual
+ * call per node. A `FlatComposite` compiles its subtree into a depth-first array of
+ * node pointers and subtree sizes, and `operation()` becomes a linear loop over it.
+ * The array is rebuilt on the next traversal after any `add`/`remove` in the subtree.
+ * ```cpp
+ * struct Node : gofpp::FlatComposite<Node> {
+ *     void visit() override { ... } // This node only; no recursion
+ * };
+ *
+ * root.operation();                          // visit() on every node, depth-first
+ * root.traverse([](Node& n) { ... });        // Same order, no virtual call
+ * ```
+ *
+ * @section links Parent links and keyed children
+ * Every node knows its parent and its position among its siblings, so `remove` is O(1)
+ * (the last child moves into the gap) and `parent()`, `root()` and `path()` cost O(depth).
+ * `KeyedComposite<T, Key>` also indexes children by `T::key()` for O(1) `find(key)`.
+ * Destroying a node removes it from its parent and orphans its children; nodes are not copyable.
+ *
+ * @section dirty Incremental updates
+ * `markDirty()` flags a node and its ancestors; `update()` then calls `refresh()` on the
+ * dirty nodes only, children first, skipping clean subtrees. `AggregateComposite<T, V>`
+ * uses this to cache a per-subtree value (e.g., a bounding box or a cost total).
+ * ```cpp
+ * struct Item : gofpp::AggregateComposite<Item, double> {
+ *     double price = 0;
+ *     double local() const override { return price; }
+ * };
+ *
+ * leaf.price = 9.5;
+ * leaf.markDirty();
+ * root.update();       // Refreshes leaf and its ancestors only
+ * root.aggregate();    // Total price of the tree
+ * ```
+ *
+ * @section parallel Parallel traversal
+ * `parallelOperation()` / `parallelTraverse(fn)` split the flat layout into tasks on a
+ * work-stealing `TaskPool`. Ranges or subtrees of at most `grain` nodes run serially.
+ * With `parentsFirst` every node is visited only after its parent (subtree tasks);
+ * without it the layout is simply cut into ranges, which balances best.
+ * ```cpp
+ * root.parallelOperation({.grain = 2048, .parentsFirst = true});
+ * ```
+ * `visit()` / `fn` run concurrently on different nodes and must be safe to do so;
+ * the tree must not change shape during the traversal.
+ *
  * @version 0.1
  * @date 2025-08-05
  * @copyright
@@ -31,20 +81,76 @@
 #pragma once
 #include <vector>
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <gofpp/threading.hpp>
 
 namespace gofpp {
 
 template <typename T>
 class Composite {
 public:
-    virtual ~Composite() = default;
+    Composite() = default;
+    Composite(const Composite&) = delete; // Nodes are identities: parents and children point at them
+    Composite& operator=(const Composite&) = delete;
 
+    // Leaves the parent and orphans the children, so no node keeps a dangling link.
+    // The derived parts are gone by now, so the parent's detaching() is not called.
+    virtual ~Composite() {
+        if (parentNode) parentNode->unlink(*this);
+        for (T* child : children) {
+            Composite& c = *child;
+            c.parentNode = nullptr;
+            c.dirtyPrev = c.dirtyNext = nullptr;
+        }
+    }
+
+    // Attaches child, detaching it from its current parent first.
     void add(T* child) {
+        Composite& c = *child;
+        if (c.parentNode == this) return;
+        attaching(child); // May reject the child before anything changes
+        if (c.parentNode) c.parentNode->detach(c);
+        c.parentNode = this;
+        c.slot = children.size();
         children.push_back(child);
+        if (c.dirty) c.linkDirty();
+        touch();
+        markDirty();
     }
 
+    // O(1): the last child takes the removed child's place, so sibling order is not kept.
     void remove(T* child) {
-        children.erase(std::remove(children.begin(), children.end(), child), children.end());
+        Composite& c = *child;
+        if (c.parentNode != this) return;
+        detach(c);
+    }
+
+    T* parent() const { return static_cast<T*>(parentNode); }
+
+    T* root() {
+        Composite* n = this;
+        while (n->parentNode) n = n->parentNode;
+        return static_cast<T*>(n);
+    }
+
+    std::size_t depth() const {
+        std::size_t d = 0;
+        for (Composite* n = parentNode; n; n = n->parentNode) ++d;
+        return d;
+    }
+
+    // Nodes from the root down to this one: O(depth).
+    std::vector<T*> path() {
+        std::vector<T*> nodes(depth() + 1);
+        Composite* n = this;
+        for (auto it = nodes.rbegin(); it != nodes.rend(); ++it, n = n->parentNode) *it = static_cast<T*>(n);
+        return nodes;
     }
 
     virtual void operation() {
@@ -53,8 +159,297 @@ public:
         }
     }
 
+    // Flags this node and its ancestors for the next update(). Stops at the first
+    // ancestor that is already dirty: its own ancestors are dirty too.
+    void markDirty() {
+        for (Composite* n = this; n && !n->dirty; n = n->parentNode) {
+            n->dirty = true;
+            if (n->parentNode) n->linkDirty();
+        }
+    }
+
+    bool isDirty() const { return dirty; }
+
+    // Calls refresh() on every dirty node, children before parents, and clears the flags.
+    // Only dirty nodes are visited: each keeps a list of its dirty children. Iterative,
+    // climbing back through parent links, so deep trees cannot overflow the stack.
+    void update() {
+        if (!dirty) return;
+        if (parentNode) unlinkDirty(); // The parent stays dirty, but need not revisit us
+        Composite* n = this;
+        for (;;) {
+            if (Composite* c = n->dirtyHead) {
+                n->dirtyHead = c->dirtyNext;
+                if (c->dirtyNext) c->dirtyNext->dirtyPrev = nullptr;
+                c->dirtyNext = nullptr;
+                n = c;
+                continue;
+            }
+            n->dirty = false;
+            n->refresh();
+            if (n == this) return;
+            n = n->parentNode;
+        }
+    }
+
 protected:
+    // Recomputes state derived from this node and its (already updated) children.
+    virtual void refresh() {}
+
+    // Called before child is attached (may throw to refuse it) and before it is detached
+    // by add()/remove(). Not called when an attached child is destroyed.
+    virtual void attaching(T*) {}
+    virtual void detaching(T*) {}
+
+    // Changes whenever a node is added to or removed from this subtree.
+    std::uint64_t structureVersion() const { return version; }
+
+    // Read freely; change only through add()/remove(), which keep parent links and slots.
     std::vector<T*> children;
+
+private:
+    void detach(Composite& c) {
+        detaching(static_cast<T*>(&c));
+        unlink(c);
+    }
+
+    void unlink(Composite& c) {
+        T* last = children.back();
+        children[c.slot] = last;
+        static_cast<Composite&>(*last).slot = c.slot;
+        children.pop_back();
+        if (c.dirty) c.unlinkDirty();
+        c.parentNode = nullptr;
+        touch();
+        markDirty();
+    }
+
+    // A dirty node with a parent is in the parent's dirty list, and nowhere else.
+    void linkDirty() {
+        dirtyPrev = nullptr;
+        dirtyNext = parentNode->dirtyHead;
+        if (dirtyNext) dirtyNext->dirtyPrev = this;
+        parentNode->dirtyHead = this;
+    }
+
+    void unlinkDirty() {
+        if (dirtyPrev) dirtyPrev->dirtyNext = dirtyNext;
+        else parentNode->dirtyHead = dirtyNext;
+        if (dirtyNext) dirtyNext->dirtyPrev = dirtyPrev;
+        dirtyPrev = dirtyNext = nullptr;
+    }
+
+    // O(depth): every ancestor's subtree changed shape too.
+    void touch() {
+        for (Composite* n = this; n; n = n->parentNode) ++n->version;
+    }
+
+    Composite* parentNode = nullptr;
+    std::size_t slot = 0; // Position in parentNode->children
+    std::uint64_t version = 0;
+    Composite* dirtyHead = nullptr; // Dirty children, linked through dirtyPrev/dirtyNext
+    Composite* dirtyPrev = nullptr;
+    Composite* dirtyNext = nullptr;
+    bool dirty = true; // New nodes have never been refreshed
+};
+
+/**
+ * @brief Composite that caches a per-subtree aggregate, recomputed by update() along dirty paths only.
+ */
+template <typename T, typename V>
+class AggregateComposite : public Composite<T> {
+public:
+    // Aggregate of this subtree as of the last update().
+    const V& aggregate() const { return cached; }
+
+protected:
+    // This node's own contribution.
+    virtual V local() const = 0;
+
+    virtual V combine(V acc, const V& child) const { return acc + child; }
+
+    void refresh() override {
+        V acc = local();
+        for (T* child : this->children) acc = combine(std::move(acc), child->aggregate());
+        cached = std::move(acc);
+    }
+
+private:
+    V cached{};
+};
+
+/**
+ * @brief Composite with a hashed index of its children by key. T provides `key()`,
+ * which must not change while the node is attached.
+ */
+template <typename T, typename Key, typename Hash = std::hash<Key>>
+class KeyedComposite : public Composite<T> {
+public:
+    KeyedComposite() = default;
+
+    // ~Composite unlinks this node without detaching(), so drop the parent's index entry here.
+    ~KeyedComposite() override {
+        if (T* p = this->parent()) static_cast<KeyedComposite&>(*p).index.erase(*indexedKey);
+    }
+
+    // The child with this key, or nullptr: O(1).
+    T* find(const Key& key) const {
+        auto it = index.find(key);
+        return it != index.end() ? it->second : nullptr;
+    }
+
+protected:
+    void attaching(T* child) override {
+        auto [it, inserted] = index.try_emplace(child->key(), child);
+        if (!inserted) throw std::invalid_argument("KeyedComposite: duplicate child key");
+        static_cast<KeyedComposite&>(*child).indexedKey = &it->first;
+    }
+    void detaching(T* child) override { index.erase(*static_cast<KeyedComposite&>(*child).indexedKey); }
+
+private:
+    std::unordered_map<Key, T*, Hash> index;
+    const Key* indexedKey = nullptr; // This node's key in its parent's index (node-based: stable)
+};
+
+/**
+ * @brief Depth-first layout of a subtree: node i's subtree is nodes[i, i + subtreeSize[i]).
+ */
+template <typename T>
+struct FlatLayout {
+    std::vector<T*> nodes;
+    std::vector<std::uint32_t> subtreeSize;
+};
+
+/**
+ * @brief Tuning for FlatComposite's parallel traversal.
+ */
+struct ParallelOptions {
+    std::size_t grain = 1024;  // Ranges/subtrees of at most this many nodes run serially
+    bool parentsFirst = false; // Visit each node only after its parent
+    TaskPool* pool = nullptr;  // nullptr: TaskPool::shared()
+};
+
+template <typename T>
+class FlatComposite : public Composite<T> {
+public:
+    // Per-node work; operation() calls it once for every node, parents before children.
+    virtual void visit() {}
+
+    void operation() override {
+        traverse([](T& node) { node.visit(); });
+    }
+
+    // Calls fn(T&) for every node of this subtree in depth-first order.
+    template <typename Fn>
+    void traverse(Fn&& fn) {
+        const auto& nodes = layout().nodes;
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+#if defined(__GNUC__)
+            if (i + prefetchDistance < nodes.size()) __builtin_prefetch(nodes[i + prefetchDistance]);
+#endif
+            fn(*nodes[i]);
+        }
+    }
+
+    void parallelOperation(const ParallelOptions& options = {}) {
+        parallelTraverse([](T& node) { node.visit(); }, options);
+    }
+
+    // Calls fn(T&) once for every node of this subtree, from several threads.
+    template <typename Fn>
+    void parallelTraverse(Fn&& fn, const ParallelOptions& options = {}) {
+        const auto& flat = layout(); // Built here, read-only while tasks run
+        TaskPool& pool = options.pool ? *options.pool : TaskPool::shared();
+        Walker<Fn> walker{flat, fn, pool, std::max<std::size_t>(options.grain, 1)};
+        pool.run([&] {
+            if (options.parentsFirst) walker.subtree(0);
+            else walker.split(0, flat.nodes.size());
+        });
+    }
+
+    // Rebuilds the layout if this subtree changed since the last call.
+    const FlatLayout<T>& layout() {
+        if (!flat) flat = std::make_unique<FlatLayout<T>>();
+        if (flat->nodes.empty() || builtVersion != this->structureVersion()) rebuild(*flat);
+        return *flat;
+    }
+
+private:
+    template <typename Fn>
+    struct Walker {
+        const FlatLayout<T>& flat;
+        Fn& fn;
+        TaskPool& pool;
+        std::size_t grain;
+
+        void serial(std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) fn(*flat.nodes[i]);
+        }
+
+        // Halves the range, handing one half to the pool, until it is grain-sized.
+        void split(std::size_t begin, std::size_t end) {
+            while (end - begin > grain) {
+                std::size_t mid = begin + (end - begin) / 2;
+                pool.spawn([this, mid, end] { split(mid, end); });
+                end = mid;
+            }
+            serial(begin, end);
+        }
+
+        // Visits node i, then hands its children to the pool: large child subtrees as
+        // their own tasks, runs of small siblings (contiguous in the layout) batched to
+        // about grain nodes. One large child continues on this thread, so chains don't
+        // turn into one task per node.
+        void subtree(std::size_t i) {
+            constexpr std::size_t none = static_cast<std::size_t>(-1);
+            const auto& size = flat.subtreeSize;
+            for (;;) {
+                if (size[i] <= grain) return serial(i, i + size[i]);
+                fn(*flat.nodes[i]);
+
+                std::size_t end = i + size[i], next = none, batch = i + 1;
+                for (std::size_t c = i + 1; c < end; c += size[c]) {
+                    std::size_t after = c + size[c];
+                    if (size[c] > grain) {
+                        if (batch < c) pool.spawn([this, batch, c] { serial(batch, c); });
+                        if (next != none) pool.spawn([this, next] { subtree(next); });
+                        next = c;
+                        batch = after;
+                    } else if (after - batch >= grain) {
+                        pool.spawn([this, batch, after] { serial(batch, after); });
+                        batch = after;
+                    }
+                }
+                if (next == none) return serial(batch, end);
+                if (batch < end) pool.spawn([this, batch, end] { serial(batch, end); });
+                i = next;
+            }
+        }
+    };
+
+    // Iterative pre-order walk, so deep trees cannot overflow the stack.
+    void rebuild(FlatLayout<T>& out) {
+        out.nodes.clear();
+        std::vector<std::uint32_t> parentIndex;
+        std::vector<std::pair<T*, std::uint32_t>> stack{{static_cast<T*>(this), 0}};
+        while (!stack.empty()) {
+            auto [node, parent] = stack.back();
+            stack.pop_back();
+            std::uint32_t index = static_cast<std::uint32_t>(out.nodes.size());
+            out.nodes.push_back(node);
+            parentIndex.push_back(parent);
+            for (auto it = node->children.rbegin(); it != node->children.rend(); ++it) stack.emplace_back(*it, index);
+        }
+
+        out.subtreeSize.assign(out.nodes.size(), 1);
+        for (std::size_t i = out.nodes.size() - 1; i > 0; --i) out.subtreeSize[parentIndex[i]] += out.subtreeSize[i];
+        builtVersion = this->structureVersion();
+    }
+
+    static constexpr std::size_t prefetchDistance = 8; // Nodes are scattered; the array says where
+
+    std::unique_ptr<FlatLayout<T>> flat; // Out of line: only traversal roots pay for it
+    std::uint64_t builtVersion = 0;
 };
 
 } // namespace gofpp
@@ -22,6 +22,11 @@
  * };
  * ```
  *
+ * @section threading Threading
+ * - Default: `SingleThreaded` (no locking).
+ * - Optional: `MultiThreaded` (mutex-protected).
+ * - Optional: `SharedMutexThreaded` (hits take a shared lock, misses an exclusive one).
+ *
  * @version 0.1
  * @date 2025-08-05
  * @copyright
@@ -31,18 +36,24 @@
 #pragma once
 #include <unordered_map>
 #include <memory>
+#include <gofpp/threading.hpp>
 
 namespace gofpp {
 
-template <typename Key, typename Value>
-class FlyweightFactory {
+template <typename Key, typename Value, typename ThreadPolicy = SingleThreaded>
+class FlyweightFactory : private ThreadPolicy {
 public:
     std::shared_ptr<Value> get(const Key& key) {
-        auto it = pool.find(key);
+        {
+            typename ThreadPolicy::SharedLock lock(*this);
+            auto it = pool.find(key);
+            if (it != pool.end()) return it->second;
+        }
+        typename ThreadPolicy::Lock lock(*this);
+        auto it = pool.find(key); // Another writer may have won the race
         if (it != pool.end()) return it->second;
-        auto val = std::make_shared<Value>(Value{key});
-        pool[key] = val;
-        return val;
+        auto value = std::make_shared<Value>(Value{key}); // Built first: a throw leaves no entry behind
+        return pool.emplace(key, std::move(value)).first->second;
     }
 
 private:
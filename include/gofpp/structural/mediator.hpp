@@ -8,6 +8,8 @@
  * @section features Key Features
  * - Components interact via Mediator, not directly with each other.
  * - Decouples complex dependency webs (e.g., Editor panels).
+ * - `TypedMediator`: interned IDs and a precomputed routing table, no per-message strings.
+ * - `AsyncMediator`: bounded per-component mailboxes with backpressure and metrics.
  *
  * @section usage Example Usage
  * ```cpp
@@ -22,6 +24,42 @@
  * };
  * ```
  *
+ * @section typed Typed mediator
+ * `Mediator::notify` builds and compares strings on every message. `TypedMediator<Args...>`
+ * interns sender and event names into integer IDs once, at registration, and compiles
+ * its routes into a table indexed by (sender, event). `send` is an index computation and
+ * a loop over the matching handlers: no allocation and no string comparison.
+ * ```cpp
+ * gofpp::TypedMediator<int> editor;                   // Handlers take an int payload
+ * auto viewport = editor.sender("Viewport");
+ * auto selected = editor.event("SelectionChanged");
+ *
+ * editor.on(viewport, selected, [](int id) { ... });  // From the viewport only
+ * editor.on(selected, [](int id) { ... });            // From any sender
+ *
+ * editor.send(viewport, selected, 42);
+ * ```
+ * The table is rebuilt on the first `send` after names or routes were added; register
+ * up front to keep that out of the hot path. Handlers must not register routes.
+ *
+ * @section async Asynchronous mediator
+ * `AsyncMediator<Message>` gives each registered component a bounded lock-free mailbox
+ * (many producers, one drainer at a time), so a slow component never stalls its senders.
+ * Each mailbox chooses what happens when it is full: `Block` the sender, `DropOldest`
+ * queued message, or `Fail` the post. Components drain on their own thread (`wait` +
+ * `drain`) or all mailboxes are drained in batches on a shared `TaskPool`.
+ * ```cpp
+ * gofpp::AsyncMediator<Event> bus;
+ * auto ui = bus.add([](Event& e) { ... }, {.capacity = 256, .backpressure = gofpp::Backpressure::DropOldest});
+ * auto db = bus.add([](Event& e) { ... });       // 1024 slots, Block
+ *
+ * bus.post(db, Event{...});                      // From any thread
+ * bus.drainAll(pool, 64);                        // Up to 64 messages per mailbox, in parallel
+ * auto s = bus.stats(ui);                        // depth, highWater, dropped, maxLatency, ...
+ * ```
+ * Register every component before posting from several threads. `Message` must be
+ * default-constructible and movable.
+ *
  * @version 0.1
  * @date 2025-08-05
  * @copyright
@@ -29,7 +67,25 @@
  */
 
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <gofpp/threading.hpp>
+#include <gofpp/detail/string_hash.hpp>
 
 namespace gofpp {
 
@@ -39,4 +95,403 @@ public:
     virtual void notify(const std::string& sender, const std::string& event) = 0;
 };
 
+/**
+ * @brief Interned sender name.
+ */
+struct SenderId {
+    std::uint32_t index = ~std::uint32_t{0};
+    friend bool operator==(SenderId, SenderId) = default;
+};
+
+/**
+ * @brief Interned event name.
+ */
+struct EventId {
+    std::uint32_t index = ~std::uint32_t{0};
+    friend bool operator==(EventId, EventId) = default;
+};
+
+template <typename... Args>
+class TypedMediator {
+public:
+    using Handler = std::function<void(Args...)>;
+
+    // Id for name, assigned on first use.
+    SenderId sender(std::string_view name) { return {intern(senders, name)}; }
+    EventId event(std::string_view name) { return {intern(events, name)}; }
+
+    // Routes ev from one sender to handler.
+    void on(SenderId from, EventId ev, Handler handler) {
+        routes.push_back({from.index, ev.index, std::move(handler)});
+        stale = true;
+    }
+
+    // Routes ev from every sender to handler.
+    void on(EventId ev, Handler handler) { on(SenderId{}, ev, std::move(handler)); }
+
+    // Calls each handler routed for (from, ev), in registration order.
+    void send(SenderId from, EventId ev, Args... args) {
+        if (stale) compile();
+        if (from.index >= senders.size() || ev.index >= events.size()) return;
+        std::size_t cell = std::size_t(from.index) * events.size() + ev.index;
+        for (std::uint32_t i = offsets[cell]; i < offsets[cell + 1]; ++i) routes[table[i]].handler(args...);
+    }
+
+    // Looks the names up (no allocation) and sends; unknown names reach no handler.
+    void send(std::string_view from, std::string_view ev, Args... args) {
+        auto s = senders.find(from);
+        auto e = events.find(ev);
+        if (s != senders.end() && e != events.end()) send(SenderId{s->second}, EventId{e->second}, args...);
+    }
+
+private:
+    using Names = std::unordered_map<std::string, std::uint32_t, StringHash, std::equal_to<>>;
+
+    struct Route {
+        std::uint32_t sender; // SenderId{}.index: any sender
+        std::uint32_t event;
+        Handler handler;
+    };
+
+    std::uint32_t intern(Names& names, std::string_view name) {
+        auto it = names.find(name);
+        if (it != names.end()) return it->second;
+        stale = true;
+        return names.emplace(std::string(name), static_cast<std::uint32_t>(names.size())).first->second;
+    }
+
+    // Counting sort of routes into (sender, event) cells; wildcard routes join every sender's cell.
+    void compile() {
+        const std::size_t cells = senders.size() * events.size();
+        offsets.assign(cells + 1, 0);
+        auto forEachCell = [&](const Route& r, auto&& fn) {
+            if (r.event >= events.size()) return;
+            if (r.sender == SenderId{}.index) {
+                for (std::size_t s = 0; s < senders.size(); ++s) fn(s * events.size() + r.event);
+            } else if (r.sender < senders.size()) {
+                fn(std::size_t(r.sender) * events.size() + r.event);
+            }
+        };
+        for (const Route& r : routes) forEachCell(r, [&](std::size_t cell) { ++offsets[cell + 1]; });
+        for (std::size_t c = 0; c < cells; ++c) offsets[c + 1] += offsets[c];
+
+        table.assign(offsets[cells], 0);
+        std::vector<std::uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (std::uint32_t i = 0; i < routes.size(); ++i) {
+            forEachCell(routes[i], [&](std::size_t cell) { table[fill[cell]++] = i; });
+        }
+        stale = false;
+    }
+
+    Names senders;
+    Names events;
+    std::vector<Route> routes;
+    std::vector<std::uint32_t> offsets{0}; // Cell c's routes are table[offsets[c], offsets[c + 1])
+    std::vector<std::uint32_t> table;      // Route indices grouped by cell
+    bool stale = false;
+};
+
+namespace detail {
+
+// Bounded lock-free queue (Vyukov): each cell's sequence number says whether it is free
+// for the producer holding ticket pos (seq == pos) or filled for that ticket (seq == pos + 1).
+template <typename T>
+class BoundedQueue {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit BoundedQueue(std::size_t capacity)
+        : mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1), cells(new Cell[mask + 1]) {
+        for (std::size_t i = 0; i <= mask; ++i) cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    ~BoundedQueue() {
+        T out;
+        Clock::time_point at;
+        while (pop(out, at)) {}
+    }
+
+    template <typename U>
+    bool push(U&& value) {
+        std::size_t pos = tail.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& c = cells[pos & mask];
+            auto diff = static_cast<std::ptrdiff_t>(c.seq.load(std::memory_order_acquire) - pos);
+            if (diff == 0) {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    ::new (c.storage) T(std::forward<U>(value));
+                    c.postedAt = Clock::now();
+                    c.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Full
+            } else {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(T& out, Clock::time_point& postedAt) {
+        std::size_t pos = head.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& c = cells[pos & mask];
+            auto diff = static_cast<std::ptrdiff_t>(c.seq.load(std::memory_order_acquire) - (pos + 1));
+            if (diff == 0) {
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    T* value = std::launder(reinterpret_cast<T*>(c.storage));
+                    out = std::move(*value);
+                    value->~T();
+                    postedAt = c.postedAt;
+                    c.seq.store(pos + mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Empty
+            } else {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::size_t capacity() const { return mask + 1; }
+    std::size_t pushed() const { return tail.load(std::memory_order_relaxed); }
+    std::size_t popped() const { return head.load(std::memory_order_relaxed); }
+    std::size_t size() const {
+        std::size_t h = popped(), t = pushed();
+        return t > h ? t - h : 0;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> seq;
+        Clock::time_point postedAt;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    const std::size_t mask;
+    std::unique_ptr<Cell[]> cells;
+    alignas(cacheLineSize) std::atomic<std::size_t> tail{0}; // Producers
+    alignas(cacheLineSize) std::atomic<std::size_t> head{0}; // Drainer (and DropOldest producers)
+};
+
+} // namespace detail
+
+/**
+ * @brief What AsyncMediator::post does when the target mailbox is full.
+ */
+enum class Backpressure {
+    Block,      // Wait for the drainer to make room
+    DropOldest, // Discard the oldest queued message
+    Fail        // Return PostResult::Rejected
+};
+
+enum class PostResult { Queued, QueuedDroppedOldest, Rejected };
+
+struct MailboxOptions {
+    std::size_t capacity = 1024; // Rounded up to a power of two
+    Backpressure backpressure = Backpressure::Block;
+};
+
+/**
+ * @brief Snapshot of one mailbox's counters.
+ */
+struct MailboxStats {
+    std::size_t depth = 0;     // Messages waiting now
+    std::size_t highWater = 0; // Largest depth seen by a sender
+    std::uint64_t posted = 0;
+    std::uint64_t delivered = 0;
+    std::uint64_t dropped = 0;
+    std::uint64_t rejected = 0;
+    std::chrono::nanoseconds meanLatency{0}; // Post to handler call
+    std::chrono::nanoseconds maxLatency{0};
+};
+
+/**
+ * @brief Handle to a mailbox registered with an AsyncMediator.
+ */
+struct MailboxId {
+    std::uint32_t index = ~std::uint32_t{0};
+    friend bool operator==(MailboxId, MailboxId) = default;
+};
+
+template <typename Message>
+class AsyncMediator {
+public:
+    using Handler = std::function<void(Message&)>;
+
+    MailboxId add(Handler handler, MailboxOptions options = {}) {
+        mailboxes.push_back(std::make_unique<Mailbox>(std::move(handler), options));
+        return {static_cast<std::uint32_t>(mailboxes.size() - 1)};
+    }
+
+    std::size_t size() const { return mailboxes.size(); }
+
+    // Queues msg for one component; never calls a handler.
+    PostResult post(MailboxId to, Message msg) {
+        Mailbox& box = *mailboxes[to.index];
+        PostResult result = PostResult::Queued;
+        while (!box.queue.push(std::move(msg))) {
+            switch (box.options.backpressure) {
+            case Backpressure::Fail:
+                box.rejected.fetch_add(1, std::memory_order_relaxed);
+                return PostResult::Rejected;
+            case Backpressure::DropOldest: {
+                Message old;
+                typename Queue::Clock::time_point at;
+                if (box.queue.pop(old, at)) {
+                    box.dropped.fetch_add(1, std::memory_order_relaxed);
+                    result = PostResult::QueuedDroppedOldest;
+                }
+                break;
+            }
+            case Backpressure::Block:
+                box.waitForRoom();
+                break;
+            }
+        }
+        box.noteDepth();
+        box.wake();
+        return result;
+    }
+
+    // Posts a copy of msg to every mailbox.
+    void broadcast(const Message& msg) {
+        for (std::uint32_t i = 0; i < mailboxes.size(); ++i) post({i}, msg);
+    }
+
+    // Delivers up to maxBatch queued messages to the component's handler; returns how many.
+    // Returns 0 at once if another thread is draining this mailbox.
+    std::size_t drain(MailboxId id, std::size_t maxBatch = static_cast<std::size_t>(-1)) {
+        return mailboxes[id.index]->drain(maxBatch);
+    }
+
+    // Drains every mailbox in turn on the calling thread.
+    std::size_t drainAll(std::size_t maxBatch = static_cast<std::size_t>(-1)) {
+        std::size_t n = 0;
+        for (auto& box : mailboxes) n += box->drain(maxBatch);
+        return n;
+    }
+
+    // Drains every non-empty mailbox as its own task on pool.
+    std::size_t drainAll(TaskPool& pool, std::size_t maxBatch = static_cast<std::size_t>(-1)) {
+        std::atomic<std::size_t> n{0};
+        pool.run([&] {
+            for (auto& box : mailboxes) {
+                if (box->queue.size() == 0) continue;
+                pool.spawn([&n, b = box.get(), maxBatch] { n.fetch_add(b->drain(maxBatch), std::memory_order_relaxed); });
+            }
+        });
+        return n.load(std::memory_order_relaxed);
+    }
+
+    // Blocks the component's thread until its mailbox has a message or timeout passes.
+    // Returns whether a message is waiting.
+    bool wait(MailboxId id, std::chrono::milliseconds timeout) {
+        return mailboxes[id.index]->waitForMessage(timeout);
+    }
+
+    MailboxStats stats(MailboxId id) const { return mailboxes[id.index]->stats(); }
+
+private:
+    using Queue = detail::BoundedQueue<Message>;
+
+    struct Mailbox {
+        Mailbox(Handler h, MailboxOptions o) : handler(std::move(h)), options(o), queue(o.capacity) {}
+
+        std::size_t drain(std::size_t maxBatch) {
+            if (draining.exchange(true, std::memory_order_acquire)) return 0;
+            struct Release {
+                std::atomic<bool>& flag;
+                ~Release() { flag.store(false, std::memory_order_release); }
+            } release{draining};
+
+            std::size_t n = 0;
+            Message msg;
+            typename Queue::Clock::time_point postedAt;
+            while (n < maxBatch && queue.pop(msg, postedAt)) {
+                if (options.backpressure == Backpressure::Block) {
+                    room.store(room.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+                    room.notify_all();
+                }
+                auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(Queue::Clock::now() - postedAt).count();
+                // Only the drainer writes these: plain load + store, no read-modify-write
+                latencySum.store(latencySum.load(std::memory_order_relaxed) + latency, std::memory_order_relaxed);
+                if (latency > maxLatency.load(std::memory_order_relaxed)) maxLatency.store(latency, std::memory_order_relaxed);
+                ++n;
+                delivered.store(delivered.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                handler(msg);
+            }
+            return n;
+        }
+
+        void noteDepth() {
+            std::size_t depth = queue.size();
+            std::size_t seen = highWater.load(std::memory_order_relaxed);
+            while (depth > seen && !highWater.compare_exchange_weak(seen, depth, std::memory_order_relaxed)) {}
+        }
+
+        // Senders blocked on a full mailbox sleep on room, which the drainer bumps.
+        void waitForRoom() {
+            std::uint32_t seen = room.load(std::memory_order_acquire);
+            if (queue.size() < queue.capacity()) return;
+            room.wait(seen, std::memory_order_acquire);
+        }
+
+        // The fence pairs with the one in waitForMessage: either the sender sees the
+        // drainer waiting, or the drainer sees the message.
+        void wake() {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_relaxed)) {
+                std::lock_guard<std::mutex> lock(m);
+                arrived.notify_one();
+            }
+        }
+
+        bool waitForMessage(std::chrono::milliseconds timeout) {
+            waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            bool ready;
+            {
+                std::unique_lock<std::mutex> lock(m);
+                ready = arrived.wait_for(lock, timeout, [&] { return queue.size() != 0; });
+            }
+            waiting.store(false, std::memory_order_relaxed);
+            return ready;
+        }
+
+        MailboxStats stats() const {
+            MailboxStats s;
+            s.depth = queue.size();
+            s.highWater = highWater.load(std::memory_order_relaxed);
+            s.posted = queue.pushed();
+            s.delivered = delivered.load(std::memory_order_relaxed);
+            s.dropped = dropped.load(std::memory_order_relaxed);
+            s.rejected = rejected.load(std::memory_order_relaxed);
+            if (s.delivered) s.meanLatency = std::chrono::nanoseconds(latencySum.load(std::memory_order_relaxed) / s.delivered);
+            s.maxLatency = std::chrono::nanoseconds(maxLatency.load(std::memory_order_relaxed));
+            return s;
+        }
+
+        Handler handler;
+        const MailboxOptions options;
+        Queue queue;
+        std::atomic<bool> draining{false};
+        std::atomic<std::uint32_t> room{0}; // Bumped by the drainer per message, for Block senders
+
+        std::atomic<bool> waiting{false};
+        std::mutex m;
+        std::condition_variable arrived;
+
+        std::atomic<std::size_t> highWater{0};
+        std::atomic<std::uint64_t> dropped{0};
+        std::atomic<std::uint64_t> rejected{0};
+        std::atomic<std::uint64_t> delivered{0};  // Drainer-only writes
+        std::atomic<std::uint64_t> latencySum{0}; // Drainer-only writes, ns
+        std::atomic<std::int64_t> maxLatency{0};  // Drainer-only writes, ns
+    };
+
+    std::vector<std::unique_ptr<Mailbox>> mailboxes;
+};
+
 } // namespace gofpp
@@ -1,8 +1,29 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if defined(__linux__)
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace gofpp
 {
+    // Padding unit used to keep independently written data off shared cache lines
+    inline constexpr std::size_t cacheLineSize = 64;
+
     // Default threading policy (single-threaded = no lock)
     struct SingleThreaded {
         struct Lock {
@@ -10,13 +31,470 @@ namespace gofpp
             template <typename T>
             Lock(const T&) {} // Accepts any argument but does nothing
         };
+        using SharedLock = Lock;
     };
-    
+
     struct MultiThreaded {
         std::mutex m;
         struct Lock {
             std::unique_lock<std::mutex> lock;
             Lock(MultiThreaded& mt) : lock(mt.m) {}
         };
+        using SharedLock = Lock; // Readers still serialize on the one mutex
+    };
+
+    // Reader-writer policy: read paths take SharedLock, write paths take Lock
+    struct SharedMutexThreaded {
+        std::shared_mutex m;
+        struct Lock {
+            std::unique_lock<std::shared_mutex> lock;
+            Lock(SharedMutexThreaded& mt) : lock(mt.m) {}
+        };
+        struct SharedLock {
+            std::shared_lock<std::shared_mutex> lock;
+            SharedLock(SharedMutexThreaded& mt) : lock(mt.m) {}
+        };
+    };
+
+    // Read-copy-update policy for read-mostly registries. Only usable through Guarded:
+    // readers load an immutable snapshot (no lock, no shared writes), writers copy and republish,
+    // and free the old snapshot once every reader that might hold it has finished.
+    struct SnapshotThreaded {};
+
+    // Lock-based policy for mutable side structures of a ThreadPolicy-configured class.
+    // SnapshotThreaded has no locks of its own, so such structures fall back to MultiThreaded.
+    template <typename ThreadPolicy>
+    using LockingPolicy = std::conditional_t<std::is_same_v<ThreadPolicy, SnapshotThreaded>, MultiThreaded, ThreadPolicy>;
+
+    namespace detail {
+        // Per-thread reader slot. seq is odd while the thread is inside a read section; only its thread writes it.
+        struct alignas(cacheLineSize) ReaderSlot {
+            std::atomic<std::uint64_t> seq{0};
+            std::uint64_t next = 0;  // Owner's copy of seq, so entering needs no atomic load
+            std::uint32_t depth = 0; // Nested read sections
+            bool asymmetric = false; // Writers fence for us (membarrier): a compiler barrier suffices
+
+            void enter() {
+                if (depth++ != 0) return;
+                seq.store(++next, std::memory_order_relaxed);
+                if (asymmetric) std::atomic_signal_fence(std::memory_order_seq_cst);
+                else std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+
+            void leave() {
+                if (--depth == 0) seq.store(++next, std::memory_order_release);
+            }
+        };
+
+        // Process-wide set of reader slots shared by every SnapshotThreaded structure.
+        //
+        // A reader marks its slot odd, fences, then loads the shared pointer; a writer swaps the
+        // pointer, fences, then reads the slots. The fences order the two, so either the reader
+        // sees the new pointer or the writer sees the reader. On Linux the writer's membarrier()
+        // runs the fence on every thread of the process, so readers need only a compiler barrier.
+        class ReaderRegistry {
+        public:
+            // One thread-local load on the hot path; the first call on a thread registers a slot.
+            static ReaderSlot& local() {
+                if (ReaderSlot* s = localSlot) [[likely]] return *s;
+                return attach();
+            }
+
+            // True inside a read section; never registers the calling thread.
+            static bool reading() {
+                ReaderSlot* s = localSlot;
+                return s && s->depth != 0;
+            }
+
+            // Returns once every read section open on entry has closed. Sections opened later
+            // already see the newly published pointer and are not waited for. Spins without
+            // holding the registry lock, so threads may register meanwhile.
+            static void synchronize() {
+                auto& r = instance();
+                if (r.asymmetric) r.heavyFence();
+                else std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::vector<ReaderSlot*> slots;
+                {
+                    std::lock_guard<std::mutex> lock(r.m);
+                    slots.reserve(r.slots.size());
+                    for (auto& s : r.slots) slots.push_back(s.get());
+                }
+                for (ReaderSlot* s : slots) {
+                    std::uint64_t seq = s->seq.load(std::memory_order_seq_cst);
+                    if (seq & 1) {
+                        while (s->seq.load(std::memory_order_acquire) == seq) std::this_thread::yield();
+                    }
+                }
+            }
+
+        private:
+            // Hands the slot back when its thread exits. A later thread reuses it, and seq keeps
+            // counting up, so a writer still watching it sees the change.
+            struct Holder {
+                ReaderSlot* slot;
+                ~Holder() {
+                    localSlot = nullptr;
+                    auto& r = instance();
+                    std::lock_guard<std::mutex> lock(r.m);
+                    r.idle.push_back(slot);
+                }
+            };
+
+            static ReaderSlot& attach() {
+                auto& r = instance();
+                ReaderSlot* slot;
+                {
+                    std::lock_guard<std::mutex> lock(r.m);
+                    if (!r.idle.empty()) {
+                        slot = r.idle.back();
+                        r.idle.pop_back();
+                    } else {
+                        slot = r.slots.emplace_back(std::make_unique<ReaderSlot>()).get();
+                        slot->asymmetric = r.asymmetric;
+                    }
+                }
+                thread_local Holder holder{slot};
+                localSlot = slot;
+                return *slot;
+            }
+
+            static ReaderRegistry& instance() {
+                static ReaderRegistry registry;
+                return registry;
+            }
+
+#if defined(__linux__) && defined(SYS_membarrier) // The MEMBARRIER_CMD_* values are enumerators, not macros
+            ReaderRegistry()
+                : asymmetric(syscall(SYS_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0) {}
+            void heavyFence() {
+                if (syscall(SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0) != 0) std::terminate(); // Registered above
+            }
+#else
+            void heavyFence() {}
+#endif
+
+            static inline thread_local ReaderSlot* localSlot = nullptr; // Constant-initialized: no TLS guard
+
+            const bool asymmetric = false;
+            std::mutex m;
+            std::vector<std::unique_ptr<ReaderSlot>> slots; // Never freed while the process runs: synchronize() reads them unlocked
+            std::vector<ReaderSlot*> idle;                  // Slots of exited threads
+        };
+
+        // Marks the calling thread as reading for its lifetime. Nests.
+        class ReadSection {
+        public:
+            ReadSection() : slot(&ReaderRegistry::local()) { slot->enter(); }
+            ~ReadSection() { slot->leave(); }
+            ReadSection(const ReadSection&) = delete;
+            ReadSection& operator=(const ReadSection&) = delete;
+
+        private:
+            ReaderSlot* slot;
+        };
+
+        // Objects unpublished by a SnapshotThreaded writer, freed after a grace period: once
+        // every read section that might still see them has closed. A writer inside a read
+        // section would wait for itself, so its objects stay here until the next retire()
+        // or reclaim() made outside one. Waits with no lock held.
+        template <typename T>
+        class RetireList {
+        public:
+            void retire(std::unique_ptr<T> old) {
+                auto batch = take();
+                batch.push_back(std::move(old));
+                collect(std::move(batch));
+            }
+
+            void reclaim() { collect(take()); }
+
+        private:
+            using Batch = std::vector<std::unique_ptr<T>>;
+
+            Batch take() {
+                std::lock_guard<std::mutex> lock(m);
+                return std::exchange(retired, {});
+            }
+
+            void collect(Batch batch) {
+                if (batch.empty()) return;
+                if (ReaderRegistry::reading()) {
+                    std::lock_guard<std::mutex> lock(m);
+                    for (auto& old : batch) retired.push_back(std::move(old));
+                    return;
+                }
+                ReaderRegistry::synchronize();
+            }
+
+            std::mutex m; // Guards retired; never held while waiting
+            Batch retired;
+        };
+
+        // Per-thread cache of up to `depth` pointers for each of up to `bins` owners. Owners map
+        // to a set by id and take any of its `ways` bins, so owners whose ids collide share the
+        // set instead of evicting each other. When a bin changes owner, or its thread exits, the
+        // items it holds go to Extra::dispose(extra, items, count), which must cope with their
+        // owner being gone. Extra carries whatever else a bin needs (layout, counters, a way
+        // back to the owner).
+        template <typename Extra>
+        struct ThreadCache {
+            static constexpr std::size_t ways = 4;
+            static constexpr std::size_t sets = 8;
+            static constexpr std::size_t bins = sets * ways;
+            static constexpr std::uint32_t depth = 32;
+
+            struct Bin : Extra {
+                std::uint32_t count = 0;
+                void* items[depth];
+
+                void drain() {
+                    if (count) Extra::dispose(*this, items, count);
+                    count = 0;
+                }
+            };
+
+            ~ThreadCache() {
+                for (auto& set : bin)
+                    for (auto& b : set) b.drain();
+            }
+
+            // The calling thread's cache. Function-local: GCC skips destructors of
+            // thread_local variable templates, which would leak the bins at thread exit.
+            static ThreadCache& local() {
+                thread_local ThreadCache cache;
+                return cache;
+            }
+
+            // Returns the bin for owner. If owner has none, takes a free bin in its set, or
+            // else the set's oldest claim: drains it and calls claim(bin).
+            template <typename Claim>
+            Bin& binFor(std::uint64_t owner, Claim&& claim) {
+                if (Bin* b = find(owner)) return *b;
+                std::size_t set = owner % sets;
+                std::size_t way = 0;
+                while (way < ways && owners[set][way]) ++way;
+                if (way == ways) {
+                    way = victim[set];
+                    victim[set] = std::uint8_t((way + 1) % ways);
+                }
+                Bin& b = bin[set][way];
+                b.drain();
+                owners[set][way] = owner;
+                claim(b);
+                return b;
+            }
+
+            // The bin owner holds on this thread, or nullptr.
+            Bin* find(std::uint64_t owner) {
+                std::size_t set = owner % sets;
+                for (std::size_t way = 0; way < ways; ++way)
+                    if (owners[set][way] == owner) return &bin[set][way];
+                return nullptr;
+            }
+
+            static std::uint64_t nextId() {
+                static std::atomic<std::uint64_t> counter{0};
+                return counter.fetch_add(1, std::memory_order_relaxed) + 1; // 0 marks an unused bin
+            }
+
+        private:
+            std::uint64_t owners[sets][ways] = {}; // Apart from the bins: a lookup reads one line
+            std::uint8_t victim[sets] = {};
+            Bin bin[sets][ways];
+        };
+    } // namespace detail
+
+    // State of type T accessed under ThreadPolicy via read(fn) / write(fn).
+    template <typename T, typename ThreadPolicy = SingleThreaded>
+    class Guarded : private ThreadPolicy {
+    public:
+        template <typename Fn>
+        decltype(auto) read(Fn&& fn) {
+            typename ThreadPolicy::SharedLock lock(*this);
+            return std::forward<Fn>(fn)(std::as_const(value));
+        }
+
+        template <typename Fn>
+        decltype(auto) write(Fn&& fn) {
+            typename ThreadPolicy::Lock lock(*this);
+            return std::forward<Fn>(fn)(value);
+        }
+
+    private:
+        T value{};
+    };
+
+    template <typename T>
+    class Guarded<T, SnapshotThreaded> {
+    public:
+        Guarded() : current(new T{}) {}
+        ~Guarded() { delete current.load(std::memory_order_relaxed); }
+
+        Guarded(const Guarded&) = delete;
+        Guarded& operator=(const Guarded&) = delete;
+
+        // fn runs inside a read section: the snapshot it sees is not freed until it returns.
+        template <typename Fn>
+        decltype(auto) read(Fn&& fn) const {
+            detail::ReadSection section;
+            return std::forward<Fn>(fn)(*current.load(std::memory_order_acquire));
+        }
+
+        // Copies the current snapshot, applies fn to the copy, then publishes it.
+        // The old snapshot is freed once no read() can still be using it.
+        template <typename Fn>
+        auto write(Fn&& fn) {
+            std::unique_lock<std::mutex> lock(m);
+            auto next = std::make_unique<T>(*current.load(std::memory_order_relaxed));
+            if constexpr (std::is_void_v<std::invoke_result_t<Fn&, T&>>) {
+                fn(*next);
+                publish(std::move(next), lock);
+            } else {
+                auto result = fn(*next);
+                publish(std::move(next), lock);
+                return result;
+            }
+        }
+
+        // Frees snapshots retired by a write() made inside a read(), which could not wait.
+        void reclaim() { retired.reclaim(); }
+
+    private:
+        void publish(std::unique_ptr<T> next, std::unique_lock<std::mutex>& lock) {
+            std::unique_ptr<T> old(current.exchange(next.release(), std::memory_order_acq_rel));
+            lock.unlock(); // Other writers need not wait out our grace period
+            retired.retire(std::move(old));
+        }
+
+        std::atomic<T*> current;
+        std::mutex m; // Serializes writers only
+        detail::RetireList<T> retired;
+    };
+
+    // Work-stealing task pool for fork/join parallelism. run(fn) executes fn on the calling
+    // thread; tasks it spawn()s go to the current thread's deque (LIFO for the owner),
+    // idle threads steal from the other end. run() helps until every spawned task is done.
+    class TaskPool {
+        struct Group {
+            std::atomic<std::size_t> pending{0};
+            std::mutex m;
+            std::exception_ptr error;
+        };
+        struct Task {
+            std::function<void()> fn;
+            Group* group = nullptr;
+        };
+        struct alignas(cacheLineSize) Queue {
+            std::mutex m;
+            std::deque<Task> tasks;
+        };
+        struct Context { // Thread-local, so zero-initialized
+            TaskPool* pool;
+            std::size_t queue;
+            Group* group;
+        };
+
+    public:
+        // threads counts the caller of run(): threads - 1 workers are started (0 = hardware concurrency).
+        explicit TaskPool(unsigned threads = 0)
+            : queues(std::max(1u, threads ? threads : std::thread::hardware_concurrency())) {
+            for (std::size_t i = 0; i + 1 < queues.size(); ++i) workers.emplace_back([this, i] { work(i); });
+        }
+
+        ~TaskPool() {
+            stopping.store(true, std::memory_order_release);
+            queued.fetch_add(1, std::memory_order_release);
+            queued.notify_all();
+            for (auto& w : workers) w.join();
+        }
+
+        TaskPool(const TaskPool&) = delete;
+        TaskPool& operator=(const TaskPool&) = delete;
+
+        static TaskPool& shared() {
+            static TaskPool pool;
+            return pool;
+        }
+
+        std::size_t size() const { return queues.size(); }
+
+        // Runs fn and everything it spawns; rethrows the first exception any of them threw.
+        template <typename Fn>
+        void run(Fn&& fn) {
+            Group group;
+            Context saved = current;
+            current = {this, saved.pool == this ? saved.queue : queues.size() - 1, &group};
+            group.pending.store(1, std::memory_order_relaxed);
+            Task root{std::forward<Fn>(fn), &group};
+            execute(root);
+            while (group.pending.load(std::memory_order_acquire) != 0) {
+                Task t;
+                if (take(current.queue, t)) execute(t);
+                else std::this_thread::yield();
+            }
+            current = saved;
+            if (group.error) std::rethrow_exception(group.error);
+        }
+
+        // Queues fn as part of the enclosing run(). Only valid inside a task of this pool.
+        void spawn(std::function<void()> fn) {
+            current.group->pending.fetch_add(1, std::memory_order_relaxed);
+            auto& q = queues[current.queue];
+            {
+                std::lock_guard<std::mutex> lock(q.m);
+                q.tasks.push_back({std::move(fn), current.group});
+            }
+            queued.fetch_add(1, std::memory_order_release);
+            queued.notify_one();
+        }
+
+    private:
+        void execute(Task& t) {
+            Group* outer = current.group;
+            current.group = t.group;
+            try {
+                t.fn();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(t.group->m);
+                if (!t.group->error) t.group->error = std::current_exception();
+            }
+            current.group = outer;
+            t.group->pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        // Own deque from the back, then steal from the front of the others.
+        bool take(std::size_t self, Task& out) {
+            for (std::size_t k = 0; k < queues.size(); ++k) {
+                auto& q = queues[(self + k) % queues.size()];
+                std::lock_guard<std::mutex> lock(q.m);
+                if (q.tasks.empty()) continue;
+                if (k == 0) {
+                    out = std::move(q.tasks.back());
+                    q.tasks.pop_back();
+                } else {
+                    out = std::move(q.tasks.front());
+                    q.tasks.pop_front();
+                }
+                queued.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
+
+        void work(std::size_t self) {
+            current = {this, self, nullptr};
+            while (!stopping.load(std::memory_order_acquire)) {
+                Task t;
+                if (take(self, t)) execute(t);
+                else queued.wait(0, std::memory_order_acquire);
+            }
+        }
+
+        static inline thread_local Context current;
+
+        std::vector<Queue> queues; // One per worker, plus a last one shared by external callers
+        std::vector<std::thread> workers;
+        std::atomic<std::size_t> queued{0};
+        std::atomic<bool> stopping{false};
     };
 } // namespace gofpp
@@ -36,4 +36,13 @@ TEST(Observer_Unsubscribe) {
     ASSERT_FALSE(o.called);
 }
 
+TEST(Observer_SharedMutexPolicy) {
+    gofpp::Observable<TestEvent, gofpp::SharedMutexThreaded> obs;
+    TestObserver o;
+    obs.subscribe(&o);
+
+    obs.notify({7});
+    ASSERT_EQ(o.lastData, 7);
+}
+
 int main() { return NTest::run_all(); }
@@ -1,5 +1,6 @@
 #include <NTest.h>
 #include <gofpp/creational/abstract_factory.hpp>
+#include <stdexcept>
 
 using namespace gofpp;
 
@@ -27,4 +28,52 @@ TEST(AbstractFactory_CreatesCorrectProducts) {
     ASSERT_EQ(b->id(), 2);
 }
 
+struct WinButton { constexpr int id() const { return 1; } };
+struct MacButton { constexpr int id() const { return 2; } };
+struct WinFamily { using Button = WinButton; };
+struct MacFamily { using Button = MacButton; };
+template <typename F> using ButtonOf = typename F::Button;
+
+TEST(AbstractFactory_StaticFamilies) {
+    static_assert(FamilyFactory<MacFamily>::create<ButtonOf>().id() == 2);
+
+    VariantFactory<WinFamily, MacFamily> ui(1);
+    ASSERT_EQ(ui.index(), 1u);
+    ASSERT_EQ(ui.visit([](auto family) { return family.template create<ButtonOf>().id(); }), 2);
+
+    ui.select<WinFamily>();
+    auto button = ui.create<ButtonOf>();
+    ASSERT_TRUE(std::holds_alternative<WinButton>(button));
+    ASSERT_EQ(std::visit([](auto& b) { return b.id(); }, button), 1);
+}
+
+TEST(AbstractFactory_RejectsUnknownFamilyIndex) {
+    bool threw = false;
+    try { VariantFactory<WinFamily, MacFamily> ui(2); } catch (const std::out_of_range&) { threw = true; }
+    ASSERT_TRUE(threw);
+
+    VariantFactory<WinFamily, MacFamily> ui(1);
+    threw = false;
+    try { ui.select(7); } catch (const std::out_of_range&) { threw = true; }
+    ASSERT_TRUE(threw);
+    ASSERT_EQ(ui.index(), 1u); // Unchanged
+}
+
+struct Checkbox { int family; };
+struct LinuxFamily { using Button = WinButton; using Check = Checkbox; }; // Same products as DesktopFamily
+struct DesktopFamily { using Button = WinButton; using Check = Checkbox; };
+template <typename F> using CheckOf = typename F::Check;
+
+TEST(AbstractFactory_FamiliesShareProductType) {
+    VariantFactory<DesktopFamily, LinuxFamily> ui(1);
+    auto check = ui.create<CheckOf>(7);
+    ASSERT_EQ(check.index(), 1u); // The active family's alternative, not the first Checkbox
+    ASSERT_EQ(std::get<1>(check).family, 7);
+
+    ui.select<DesktopFamily>();
+    auto button = ui.create<ButtonOf>();
+    ASSERT_EQ(button.index(), 0u);
+    ASSERT_EQ(std::get<0>(button).id(), 1);
+}
+
 int main() { return NTest::run_all(); }
\ No newline at end of file
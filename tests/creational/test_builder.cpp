@@ -1,5 +1,7 @@
 #include <NTest.h>
 #include <gofpp/creational/builder.hpp>
+#include <cstddef>
+#include <string>
 
 using namespace gofpp;
 
@@ -20,4 +22,31 @@ TEST(Builder_ConstructsCar) {
     ASSERT_TRUE(c.sunroof);
 }
 
+struct Config { std::string host; int port = 0; bool tls = false; };
+using ConfigBuilder = Builder<Config, Required<&Config::host, &Config::port>>;
+
+template <typename B>
+concept CanBuild = requires(B b) { std::move(b).build(); };
+
+TEST(Builder_RequiredFields) {
+    ConfigBuilder b;
+    Config c = b.set<&Config::port>(5432).set<&Config::tls>(true).set<&Config::host>("db").build();
+    ASSERT_EQ(c.host, std::string("db"));
+    ASSERT_EQ(c.port, 5432);
+    ASSERT_TRUE(c.tls);
+
+    ConfigBuilder partial;
+    auto missingPort = partial.set<&Config::host>("db").set<&Config::tls>(true);
+    static_assert(!CanBuild<decltype(missingPort)>);
+    static_assert(CanBuild<decltype(std::move(missingPort).set<&Config::port>(1))>);
+}
+
+TEST(Builder_EmplaceInCallerStorage) {
+    alignas(Config) std::byte storage[sizeof(Config)];
+    Config& c = ConfigBuilder::emplace(storage).set<&Config::host>("cache").set<&Config::port>(6379).done();
+    ASSERT_EQ(static_cast<void*>(&c), static_cast<void*>(storage));
+    ASSERT_EQ(c.port, 6379);
+    c.~Config();
+}
+
 int main() { return NTest::run_all(); }
\ No newline at end of file
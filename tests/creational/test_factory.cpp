@@ -1,5 +1,15 @@
 #include <gofpp/creational/factory.hpp>
 #include <NTest.h>
+#include <atomic>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
 using namespace gofpp;
 
@@ -29,6 +39,271 @@ TEST(Factory_UnknownKeyReturnsNull) {
     ASSERT_TRUE(missing == nullptr);
 }
 
+TEST(Factory_HeterogeneousKeys) {
+    Factory<Shape> factory;
+    factory.registerType<Square>("square");
+
+    std::string_view token = "square,circle";
+    ASSERT_EQ(factory.create(token.substr(0, 6))->sides(), 4);
+    ASSERT_EQ(factory.create(std::string("square"))->sides(), 4);
+    ASSERT_TRUE(factory.create(token.substr(7)) == nullptr);
+}
+
+TEST(Factory_TypeHandles) {
+    Factory<Shape> factory;
+    TypeHandle circle = factory.registerType<Circle>("circle");
+    TypeHandle square = factory.registerType<Square>("square");
+
+    ASSERT_TRUE(factory.resolve("square") == square);
+    ASSERT_EQ(factory.create(square)->sides(), 4);
+    ASSERT_EQ(factory.create(circle)->sides(), 0);
+
+    ASSERT_TRUE(factory.registerType<Square>("circle") == circle); // Re-register keeps the handle
+    ASSERT_EQ(factory.create(circle)->sides(), 4);
+
+    ASSERT_FALSE(factory.resolve("triangle"));
+    ASSERT_TRUE(factory.create(TypeHandle{}) == nullptr);
+}
+
+struct Tracked : Shape {
+    static inline int alive = 0;
+    Tracked() { ++alive; }
+    ~Tracked() override { --alive; }
+    int sides() const override { return 3; }
+};
+
+TEST(Factory_CreateInMemoryResource) {
+    Factory<Shape> factory;
+    factory.registerType<Tracked>("tracked");
+
+    std::byte buffer[256];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    {
+        auto t = factory.create("tracked", arena);
+        ASSERT_EQ(t->sides(), 3);
+        ASSERT_EQ(Tracked::alive, 1);
+        ASSERT_TRUE(static_cast<void*>(t.get()) >= static_cast<void*>(buffer));
+        ASSERT_TRUE(factory.create("missing", arena) == nullptr);
+    }
+    ASSERT_EQ(Tracked::alive, 0);
+}
+
+TEST(Factory_CreateAtCallerStorage) {
+    Factory<Shape> factory;
+    TypeHandle h = factory.registerType<Tracked>("tracked");
+    ASSERT_EQ(factory.layout(h).size, sizeof(Tracked));
+
+    alignas(Tracked) std::byte storage[sizeof(Tracked)];
+    {
+        auto t = factory.createAt(h, storage, sizeof(storage));
+        ASSERT_EQ(static_cast<void*>(t.get()), static_cast<void*>(storage));
+        ASSERT_EQ(Tracked::alive, 1);
+        ASSERT_TRUE(factory.createAt(h, storage, sizeof(Tracked) - 1) == nullptr);
+    }
+    ASSERT_EQ(Tracked::alive, 0);
+}
+
+struct Polygon : Shape {
+    const int n;
+    std::string name;
+    Polygon(int n, std::string name) : n(n), name(std::move(name)) {}
+    int sides() const override { return n; }
+};
+
+TEST(Factory_ForwardsConstructorArguments) {
+    Factory<Shape, Shape(int, std::string), MultiThreaded> factory;
+    TypeHandle poly = factory.registerType<Polygon>("polygon");
+
+    auto p = factory.create("polygon", 6, "hexagon");
+    ASSERT_EQ(p->sides(), 6);
+    ASSERT_EQ(static_cast<Polygon&>(*p).name, std::string("hexagon"));
+
+    std::pmr::monotonic_buffer_resource arena;
+    ASSERT_EQ(factory.create(poly, arena, 8, "octagon")->sides(), 8);
+    ASSERT_TRUE(factory.create("missing", 3, "") == nullptr);
+}
+
+TEST(Factory_PooledCreateRecyclesStorage) {
+    Factory<Shape> factory;
+    factory.registerType<Tracked>("tracked");
+
+    void* first = nullptr;
+    {
+        auto t = factory.createPooled("tracked");
+        first = t.get();
+        ASSERT_EQ(Tracked::alive, 1);
+    }
+    ASSERT_EQ(Tracked::alive, 0);
+    auto again = factory.createPooled("tracked");
+    ASSERT_EQ(static_cast<void*>(again.get()), first);
+
+    PoolStats stats = factory.poolStats("tracked");
+    ASSERT_EQ(stats.misses, 1u);
+    ASSERT_EQ(stats.hits, 1u);
+    ASSERT_EQ(stats.live, 1u);
+
+    again.reset();
+    ASSERT_EQ(factory.poolStats("tracked").idle, 1u);
+    factory.trim();
+    ASSERT_EQ(factory.poolStats("tracked").idle, 0u);
+}
+
+TEST(Factory_PooledCreateAcrossThreads) {
+    Factory<Shape, Shape(int, std::string), MultiThreaded> factory;
+    factory.registerType<Polygon>("polygon");
+    factory.setPoolCapacity("polygon", 8);
+
+    std::vector<Factory<Shape, Shape(int, std::string), MultiThreaded>::PooledPtr> made;
+    for (int i = 0; i < 64; ++i) made.push_back(factory.createPooled("polygon", i, "p"));
+    std::thread([&] { made.clear(); }).join(); // Released on another thread
+
+    ASSERT_EQ(factory.poolStats("polygon").live, 0u);
+    ASSERT_TRUE(factory.poolStats("polygon").idle <= 8u);
+    ASSERT_EQ(factory.createPooled("polygon", 5, "p")->sides(), 5);
+}
+
+template <int N>
+struct Numbered : Shape { int sides() const override { return N; } };
+
+TEST(Factory_PooledCachesDoNotCollide) {
+    Factory<Shape, Shape(), MultiThreaded> factory;
+    constexpr int kTypes = 33;
+    [&]<int... N>(std::integer_sequence<int, N...>) {
+        (factory.registerType<Numbered<N>>(std::to_string(N)), ...);
+    }(std::make_integer_sequence<int, kTypes>{});
+
+    PoolStats warmed;
+    std::thread([&] { // A fresh thread: no bins left over from other tests
+        // Pools take cache ids in first-use order, so types 0, 8, 16, 24 and 32 share a
+        // set, and 32 evicts 0's bin
+        for (int i = 0; i < kTypes; ++i) factory.createPooled(std::to_string(i));
+        warmed = factory.poolStats("0");
+        for (int round = 0; round < 1000; ++round) {
+            factory.createPooled("0");
+            factory.createPooled("16");
+        }
+    }).join();
+
+    ASSERT_EQ(warmed.idle, 1u); // The evicted block went back to its pool, not to the heap
+    for (const char* key : {"0", "16"}) {
+        PoolStats stats = factory.poolStats(key);
+        ASSERT_EQ(stats.misses, 1u);
+        ASSERT_EQ(stats.hits, 1000u);
+    }
+}
+
+TEST(Factory_CreateBatchIsContiguous) {
+    Factory<Shape, Shape(int, std::string)> factory;
+    factory.registerType<Polygon>("polygon");
+    {
+        Batch<Shape> batch = factory.createBatch("polygon", 16, 5, "pentagon");
+        ASSERT_EQ(batch.size(), 16u);
+
+        int sides = 0;
+        for (Shape* s : batch) sides += s->sides();
+        ASSERT_EQ(sides, 16 * 5);
+        ASSERT_EQ(reinterpret_cast<char*>(batch[1]) - reinterpret_cast<char*>(batch[0]),
+                  static_cast<std::ptrdiff_t>(sizeof(Polygon)));
+    }
+    ASSERT_TRUE(factory.createBatch("missing", 4, 1, "").empty());
+
+    Factory<Shape> tracked;
+    tracked.registerType<Tracked>("tracked");
+    {
+        auto batch = tracked.createBatch("tracked", 8);
+        ASSERT_EQ(Tracked::alive, 8);
+    }
+    ASSERT_EQ(Tracked::alive, 0);
+}
+
+struct Fragile : Shape {
+    static inline int alive = 0;
+    static inline int budget = 0;
+    Fragile() { if (budget-- == 0) throw std::runtime_error("out of budget"); ++alive; }
+    ~Fragile() override { --alive; }
+    int sides() const override { return 1; }
+};
+
+TEST(Factory_CreateBatchUnwindsThrowingConstructor) {
+    Factory<Shape> factory;
+    factory.registerType<Fragile>("fragile");
+
+    Fragile::budget = 3;
+    bool threw = false;
+    try { factory.createBatch("fragile", 8); } catch (const std::runtime_error&) { threw = true; }
+    ASSERT_TRUE(threw);
+    ASSERT_EQ(Fragile::alive, 0);
+
+    threw = false;
+    try { factory.createBatch("fragile", std::numeric_limits<std::size_t>::max() / 2); }
+    catch (const std::bad_array_new_length&) { threw = true; }
+    ASSERT_TRUE(threw);
+}
+
+TEST(Factory_SharedMutexConcurrentCreate) {
+    Factory<Shape, SharedMutexThreaded> factory;
+    factory.registerType<Circle>("circle");
+    factory.registerType<Square>("square");
+
+    std::atomic<int> sides{0};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&] {
+            for (int i = 0; i < 100; ++i) sides += factory.create("square")->sides();
+        });
+    }
+    for (auto& w : workers) w.join();
+    ASSERT_EQ(sides.load(), 4 * 100 * 4);
+}
+
+TEST(Factory_SnapshotRegisterAfterCreate) {
+    Factory<Shape, SnapshotThreaded> factory;
+    factory.registerType<Circle>("circle");
+    auto c = factory.create("circle");
+    ASSERT_TRUE(factory.create("square") == nullptr);
+
+    factory.registerType<Square>("square");
+    ASSERT_EQ(factory.create("square")->sides(), 4);
+    ASSERT_EQ(c->sides(), 0);
+
+    factory.reclaim();
+    ASSERT_EQ(factory.create("circle")->sides(), 0);
+}
+
+struct Snapshot {
+    static inline std::atomic<int> alive{0};
+    int version = 0;
+    Snapshot() { ++alive; }
+    Snapshot(const Snapshot& other) : version(other.version) { ++alive; }
+    ~Snapshot() { --alive; }
+};
+
+TEST(Factory_SnapshotWritesFreeSupersededSnapshots) {
+    {
+        Guarded<Snapshot, SnapshotThreaded> state;
+        std::atomic<bool> done{false};
+        std::thread reader([&] {
+            while (!done) {
+                state.read([](const Snapshot& s) { return s.version; });
+                std::this_thread::yield();
+            }
+        });
+        for (int i = 1; i <= 200; ++i) state.write([&](Snapshot& s) { s.version = i; });
+        done = true;
+        reader.join();
+        ASSERT_EQ(Snapshot::alive.load(), 1); // No reclaim() needed
+
+        state.read([&](const Snapshot&) {
+            state.write([](Snapshot& s) { ++s.version; }); // Cannot wait for itself: deferred
+        });
+        ASSERT_EQ(Snapshot::alive.load(), 2);
+        state.reclaim();
+        ASSERT_EQ(Snapshot::alive.load(), 1);
+        ASSERT_EQ(state.read([](const Snapshot& s) { return s.version; }), 201);
+    }
+    ASSERT_EQ(Snapshot::alive.load(), 0);
+}
+
 int main() {
     return NTest::run_all();
 }
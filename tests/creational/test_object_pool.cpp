@@ -0,0 +1,51 @@
+#include <gofpp/creational/object_pool.hpp>
+#include <NTest.h>
+#include <thread>
+#include <vector>
+
+using namespace gofpp;
+
+struct Packet {
+    static inline int constructed = 0;
+    int value = 0;
+    Packet() { ++constructed; }
+};
+
+TEST(ObjectPool_ReusesReturnedObjects) {
+    Packet::constructed = 0;
+    ObjectPool<Packet> pool(4, [](Packet& p) { p.value = 0; });
+
+    Packet* first = nullptr;
+    {
+        auto p = pool.acquire();
+        p->value = 42;
+        first = p.get();
+    }
+    auto again = pool.acquire();
+    ASSERT_EQ(again.get(), first);
+    ASSERT_EQ(again->value, 0); // Reset hook ran
+    ASSERT_EQ(Packet::constructed, 1);
+    ASSERT_EQ(pool.size(), 1u);
+}
+
+TEST(ObjectPool_GrowsBySlabs) {
+    ObjectPool<Packet> pool(2);
+    std::vector<ObjectPool<Packet>::Handle> held;
+    for (int i = 0; i < 5; ++i) held.push_back(pool.acquire());
+    ASSERT_EQ(pool.size(), 5u);
+    for (int i = 1; i < 5; ++i) ASSERT_NE(held[i].get(), held[i - 1].get());
+}
+
+TEST(ObjectPool_CrossThreadReturn) {
+    ObjectPool<Packet, MultiThreaded> pool(16);
+    std::vector<ObjectPool<Packet, MultiThreaded>::Handle> made;
+    for (int i = 0; i < 100; ++i) made.push_back(pool.acquire());
+
+    std::thread([&] { made.clear(); }).join(); // Returned via the worker's magazine at thread exit
+    for (int i = 0; i < 100; ++i) made.push_back(pool.acquire());
+    ASSERT_EQ(pool.size(), 100u);
+}
+
+int main() {
+    return NTest::run_all();
+}
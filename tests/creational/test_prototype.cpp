@@ -1,5 +1,8 @@
 #include <NTest.h>
 #include <gofpp/creational/prototype.hpp>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 using namespace gofpp;
 
@@ -18,4 +21,126 @@ TEST(Prototype_CloneObject) {
     ASSERT_EQ(copy->sides, 5);
 }
 
+struct Unit : Prototype<Unit> { virtual int hp() const = 0; };
+struct Goblin : Cloneable<Goblin, Unit> { int health = 7; int hp() const override { return health; } };
+struct Dragon : Cloneable<Dragon, Unit> { char hoard[256] = {}; int hp() const override { return 900; } };
+
+TEST(Prototype_PolyValueInlineClone) {
+    Goblin prefab;
+    prefab.health = 12;
+
+    auto a = PolyValue<Unit>::cloneOf(prefab);
+    ASSERT_TRUE(a.isInline());
+    ASSERT_EQ(a->hp(), 12);
+
+    PolyValue<Unit> b = a; // Copy clones into b's own buffer
+    ASSERT_TRUE(b.isInline());
+    ASSERT_NE(a.get(), b.get());
+
+    PolyValue<Unit> c = std::move(b);
+    ASSERT_TRUE(c.isInline());
+    ASSERT_EQ(c->hp(), 12);
+    ASSERT_FALSE(b);
+}
+
+TEST(Prototype_PolyValueHeapFallback) {
+    Dragon prefab;
+    auto d = PolyValue<Unit>::cloneOf(prefab);
+    ASSERT_FALSE(d.isInline());
+    ASSERT_EQ(d->hp(), 900);
+
+    Unit* heap = d.get();
+    PolyValue<Unit> moved = std::move(d);
+    ASSERT_EQ(moved.get(), heap); // Heap objects move by pointer
+
+    PolyValue<Unit> emplaced(std::in_place_type<Goblin>);
+    ASSERT_TRUE(emplaced.isInline());
+    ASSERT_EQ(emplaced->hp(), 7);
+}
+
+struct Scout : Cloneable<Scout, Unit> {
+    static inline int copies = 0;
+    int health = 3;
+    Scout() = default;
+    Scout(const Scout& other) : health(other.health) { ++copies; }
+    Scout(Scout&&) noexcept = default;
+    int hp() const override { return health; }
+};
+
+struct Ogre : Cloneable<Ogre, Unit> {
+    Ogre() = default;
+    Ogre(const Ogre&) = default;
+    Ogre(Ogre&&) noexcept(false) {} // May throw: kept on the heap
+    int hp() const override { return 40; }
+};
+
+static_assert(std::is_nothrow_move_constructible_v<PolyValue<Unit>>);
+static_assert(std::is_nothrow_move_assignable_v<PolyValue<Unit>>);
+
+TEST(Prototype_PolyValueVectorGrowsWithoutCloning) {
+    std::vector<PolyValue<Unit>> army;
+    for (int i = 0; i < 100; ++i) army.emplace_back(std::in_place_type<Scout>);
+    ASSERT_EQ(Scout::copies, 0); // Reallocation moved every element
+    for (auto& unit : army) {
+        ASSERT_TRUE(unit.isInline());
+        ASSERT_EQ(unit->hp(), 3);
+    }
+
+    PolyValue<Unit> ogre(std::in_place_type<Ogre>);
+    ASSERT_FALSE(ogre.isInline());
+    ASSERT_FALSE(PolyValue<Unit>::cloneOf(Ogre{}).isInline());
+}
+
+struct Mesh {
+    std::vector<float> vertices;
+    std::size_t byteSize() const { return vertices.size() * sizeof(float); }
+};
+
+TEST(Prototype_CopyOnWriteRegistry) {
+    PrototypeRegistry<std::string, Mesh, SharedMutexThreaded> meshes;
+    meshes.add("rock", Mesh{std::vector<float>(1000, 1.0f)});
+
+    CowPtr<Mesh> a = meshes.clone("rock");
+    CowPtr<Mesh> b = meshes.clone("rock");
+    ASSERT_EQ(a.get(), b.get());
+    ASSERT_EQ(meshes.bytesSaved(), static_cast<std::int64_t>(2 * 1000 * sizeof(float)));
+
+    b.write().vertices[0] = 5.0f; // Detaches
+    ASSERT_NE(a.get(), b.get());
+    ASSERT_EQ(a->vertices[0], 1.0f);
+    ASSERT_EQ(b->vertices[0], 5.0f);
+    ASSERT_EQ(meshes.bytesSaved(), static_cast<std::int64_t>(1000 * sizeof(float)));
+
+    ASSERT_FALSE(meshes.clone("tree"));
+}
+
+TEST(Prototype_CopyOnWriteCopiesAreCounted) {
+    PrototypeRegistry<std::string, Mesh> meshes;
+    meshes.add("rock", Mesh{std::vector<float>(1000, 1.0f)});
+    const auto mesh = static_cast<std::int64_t>(1000 * sizeof(float));
+
+    CowPtr<Mesh> a = meshes.clone("rock");
+    CowPtr<Mesh> b = a; // Shares too: another copy avoided
+    ASSERT_EQ(meshes.bytesSaved(), 2 * mesh);
+
+    CowPtr<Mesh> c;
+    c = b;
+    CowPtr<Mesh> d = std::move(c); // Moves transfer the share, no new saving
+    ASSERT_EQ(meshes.bytesSaved(), 3 * mesh);
+
+    a.write();
+    b.write();
+    d.write();
+    ASSERT_EQ(meshes.bytesSaved(), 0);
+}
+
+TEST(Prototype_CopyOnWritePolymorphic) {
+    PrototypeRegistry<int, Unit> units;
+    units.add(1, Goblin{});
+    CowPtr<Unit> g = units.clone(1);
+    ASSERT_TRUE(g.isShared());
+    ASSERT_EQ(g.write().hp(), 7);
+    ASSERT_FALSE(g.isShared());
+}
+
 int main() { return NTest::run_all(); }
@@ -1,5 +1,11 @@
 #include <NTest.h>
 #include <gofpp/creational/singleton.hpp>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
 
 class TestSingleton : public gofpp::Singleton<TestSingleton> {
 public:
@@ -19,6 +25,86 @@ TEST(Singleton_StatePersistence) {
     ASSERT_EQ(b.value, 123);
 }
 
+static std::vector<char> g_events;
+static std::mutex g_eventsMutex;
+static void record(char c) { std::lock_guard<std::mutex> lock(g_eventsMutex); g_events.push_back(c); }
+
+struct ConfigSvc : gofpp::ManagedSingleton<ConfigSvc> { int port = 80; ConfigSvc() { record('c'); } ~ConfigSvc() { record('C'); } };
+struct LoggerSvc : gofpp::ManagedSingleton<LoggerSvc> { LoggerSvc() { record('l'); } ~LoggerSvc() { record('L'); } };
+struct DatabaseSvc : gofpp::ManagedSingleton<DatabaseSvc> {
+    int port;
+    DatabaseSvc() : port(LoggerSvc::IsAlive() ? ConfigSvc::Instance().port : -1) { record('d'); }
+    ~DatabaseSvc() { record('D'); }
+};
+
+static std::size_t pos(char c) {
+    return std::find(g_events.begin(), g_events.end(), c) - g_events.begin();
+}
+
+TEST(Singleton_RegistryOrderedStartupAndShutdown) {
+    g_events.clear();
+    {
+        gofpp::SingletonRegistry services;
+        services.add<DatabaseSvc, ConfigSvc, LoggerSvc>().add<ConfigSvc>().add<LoggerSvc>();
+        services.startup(4);
+        ASSERT_TRUE(services.started());
+        ASSERT_EQ(DatabaseSvc::Instance().port, 80);
+        ASSERT_EQ(pos('d'), 2u); // After both dependencies
+    }
+    ASSERT_FALSE(DatabaseSvc::IsAlive());
+    ASSERT_EQ(pos('D'), 3u); // Torn down before its dependencies
+    ASSERT_EQ(g_events.size(), 6u);
+}
+
+TEST(Singleton_RegistryRejectsRestart) {
+    gofpp::SingletonRegistry services;
+    services.add<ConfigSvc>();
+    services.startup();
+    services.shutdown();
+    bool threw = false;
+    try { services.startup(); } catch (const std::logic_error&) { threw = true; }
+    ASSERT_TRUE(threw);
+    ASSERT_FALSE(ConfigSvc::IsAlive()); // Not resurrected
+}
+
+struct CycleA : gofpp::ManagedSingleton<CycleA> {};
+struct CycleB : gofpp::ManagedSingleton<CycleB> {};
+
+TEST(Singleton_RegistryRejectsCycles) {
+    gofpp::SingletonRegistry services;
+    services.add<CycleA, CycleB>().add<CycleB, CycleA>();
+    bool threw = false;
+    try { services.startup(); } catch (const std::logic_error&) { threw = true; }
+    ASSERT_TRUE(threw);
+    ASSERT_FALSE(CycleA::IsAlive());
+}
+
+struct Tally { std::atomic<long> n{0}; };
+
+TEST(Singleton_ShardedAggregates) {
+    using Counter = gofpp::ShardedSingleton<Tally, 4>;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 8; ++t) {
+        workers.emplace_back([] {
+            for (int i = 0; i < 1000; ++i) Counter::Local().n.fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    long total = 0;
+    Counter::forEachShard([&](Tally& t) { total += t.n.load(); });
+    ASSERT_EQ(total, 8000);
+    ASSERT_NE(static_cast<void*>(&Counter::Shard(0)), static_cast<void*>(&Counter::Shard(1)));
+}
+
+TEST(Singleton_ThreadLocalInstances) {
+    int* mainInstance = &gofpp::ThreadLocalSingleton<int>::Instance();
+    int* otherInstance = nullptr;
+    std::thread([&] { otherInstance = &gofpp::ThreadLocalSingleton<int>::Instance(); }).join();
+    ASSERT_EQ(mainInstance, &gofpp::ThreadLocalSingleton<int>::Instance());
+    ASSERT_NE(mainInstance, otherInstance);
+}
+
 int main() {
     return NTest::run_all();
 }
@@ -0,0 +1,92 @@
+#include <gofpp/creational/static_factory.hpp>
+#include <NTest.h>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+using namespace gofpp;
+
+struct Shape { virtual ~Shape() = default; virtual int sides() const = 0; };
+struct Circle : Shape { int sides() const override { return 0; } };
+struct Square : Shape { int sides() const override { return 4; } };
+struct Triangle : Shape { int sides() const override { return 3; } };
+
+using Shapes = StaticFactory<Shape, Entry<"circle", Circle>, Entry<"square", Square>, Entry<"triangle", Triangle>>;
+
+constinit Shapes shapes;
+
+static_assert(Shapes::contains("triangle"));
+static_assert(!Shapes::contains("hexagon"));
+static_assert(Shapes::indexOf("square") == 1);
+
+TEST(StaticFactory_CreateByKey) {
+    ASSERT_EQ(shapes.create("circle")->sides(), 0);
+    ASSERT_EQ(shapes.create("square")->sides(), 4);
+    ASSERT_EQ(shapes.create("triangle")->sides(), 3);
+    ASSERT_TRUE(shapes.create("hexagon") == nullptr);
+    ASSERT_TRUE(shapes.create("") == nullptr);
+}
+
+TEST(StaticFactory_CompileTimeKey) {
+    auto t = shapes.create<"triangle">();
+    ASSERT_EQ(t->sides(), 3);
+}
+
+// "key_0" .. "key_253": structured keys that differ in one or two trailing bytes.
+constexpr std::size_t digits(std::size_t i) { return i < 10 ? 1 : i < 100 ? 2 : 3; }
+
+template <std::size_t I>
+constexpr auto numberedKey() {
+    char s[5 + digits(I)] = "key_";
+    std::size_t n = I;
+    for (std::size_t d = digits(I); d > 0; n /= 10) s[4 + --d] = static_cast<char>('0' + n % 10);
+    return FixedString(s);
+}
+
+template <std::size_t I>
+struct Numbered : Shape { int sides() const override { return static_cast<int>(I); } };
+
+template <typename Seq>
+struct NumberedFactory;
+template <std::size_t... I>
+struct NumberedFactory<std::index_sequence<I...>> {
+    using type = StaticFactory<Shape, Entry<numberedKey<I>(), Numbered<I>>...>;
+};
+
+using Numbers = NumberedFactory<std::make_index_sequence<254>>::type; // The largest supported table
+
+static_assert(Numbers::indexOf("key_0") == 0);
+static_assert(Numbers::indexOf("key_253") == 253);
+static_assert(!Numbers::contains("key_254"));
+
+TEST(StaticFactory_ManyStructuredKeys) {
+    Numbers numbers;
+    for (int i = 0; i < 254; ++i) {
+        auto product = numbers.create("key_" + std::to_string(i));
+        ASSERT_TRUE(product != nullptr);
+        ASSERT_EQ(product->sides(), i);
+    }
+    ASSERT_TRUE(numbers.create("key_") == nullptr);
+    ASSERT_TRUE(numbers.create("key_00") == nullptr);
+}
+
+// The table is hashed at compile time and probed at run time: both must agree for
+// every key length, including the partial trailing word.
+constexpr std::string_view alphabet = "abcdefghijklmnopqrstuvwxyz0123456789";
+constexpr auto prefixHashes = [] {
+    std::array<std::uint64_t, alphabet.size() + 1> out{};
+    for (std::size_t n = 0; n < out.size(); ++n) out[n] = detail::keyHash(alphabet.substr(0, n));
+    return out;
+}();
+
+TEST(StaticFactory_RuntimeHashMatchesCompileTime) {
+    for (std::size_t n = 0; n < prefixHashes.size(); ++n) {
+        std::string key(alphabet.substr(0, n)); // Run-time copy: takes the word-load path
+        ASSERT_EQ(detail::keyHash(key), prefixHashes[n]);
+    }
+}
+
+int main() {
+    return NTest::run_all();
+}
@@ -1,6 +1,10 @@
 #include <NTest.h>
 #include <gofpp/structural/adapter.hpp>
 
+#include <memory>
+#include <type_traits>
+#include <utility>
+
 using namespace gofpp;
 
 struct LegacyService {
@@ -23,4 +27,58 @@ TEST(Adapter_WrapsLegacyService) {
     ASSERT_EQ(adapter.getAdapted().legacyOp(), 77);
 }
 
+// Target interface for InlineAdapter: entries take the erased adaptee first.
+struct ServiceTable {
+    int (*op)(void* self, int scale);
+
+    // Any adaptee with legacyOp() adapts the same way.
+    template <typename A>
+    static constexpr ServiceTable bind() {
+        return {[](void* self, int scale) { return static_cast<A*>(self)->legacyOp() * scale; }};
+    }
+};
+
+struct LegacyCounter {
+    int value;
+    int bump() { return ++value; }
+};
+
+template <>
+inline constexpr ServiceTable gofpp::adapterVTable<ServiceTable, LegacyCounter>{
+    [](void* self, int scale) { return static_cast<LegacyCounter*>(self)->bump() * scale; }};
+
+TEST(Adapter_InlineAdapterBindsStaticVTable) {
+    InlineAdapter<ServiceTable, 16> a(LegacyService{});
+    ASSERT_EQ(a.call(&ServiceTable::op, 2), 154);
+    ASSERT_NE(a.getAdapted<LegacyService>(), nullptr);
+    ASSERT_EQ(a.getAdapted<LegacyCounter>(), nullptr);
+
+    InlineAdapter<ServiceTable, 16> c(LegacyCounter{10});
+    ASSERT_EQ(c.call(&ServiceTable::op, 1), 11);
+
+    auto copy = c; // Copies the adaptee's state
+    ASSERT_EQ(copy.call(&ServiceTable::op, 1), 12);
+    ASSERT_EQ(c.getAdapted<LegacyCounter>()->value, 11);
+
+    a = std::move(copy);
+    ASSERT_FALSE(static_cast<bool>(copy));
+    ASSERT_EQ(a.call(&ServiceTable::op, 1), 13);
+}
+
+struct LegacyStream {
+    std::unique_ptr<int> fd; // Move-only
+    int legacyOp() { return *fd; }
+};
+
+TEST(Adapter_MoveOnlyInlineAdapter) {
+    using StreamAdapter = InlineAdapter<ServiceTable, 16, false>;
+    static_assert(!std::is_copy_constructible_v<StreamAdapter>);
+    static_assert(std::is_copy_constructible_v<InlineAdapter<ServiceTable, 16>>);
+
+    StreamAdapter a(LegacyStream{std::make_unique<int>(4)});
+    StreamAdapter b = std::move(a);
+    ASSERT_FALSE(static_cast<bool>(a));
+    ASSERT_EQ(b.call(&ServiceTable::op, 3), 12);
+}
+
 int main() { return NTest::run_all(); }
\ No newline at end of file
@@ -1,6 +1,11 @@
 #include <NTest.h>
 #include <gofpp/structural/bridge.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
 using namespace gofpp;
 
 struct RendererImpl {
@@ -30,4 +35,114 @@ TEST(Bridge_SwitchImplementations) {
     ASSERT_EQ(r.render(), 2);
 }
 
+struct GLBackend {
+    int draw() const { return 1; }
+};
+
+struct VulkanBackend {
+    int scale;
+    explicit VulkanBackend(int s) : scale(s) {}
+    int draw() const { return 2 * scale; }
+};
+
+class InlineRenderer : public VariantBridge<GLBackend, VulkanBackend> {
+public:
+    using VariantBridge::VariantBridge;
+    int render() const { return visit([](const auto& backend) { return backend.draw(); }); }
+};
+
+TEST(Bridge_VariantSwitchesInline) {
+    InlineRenderer r;
+    ASSERT_TRUE(r.holds<GLBackend>());
+    ASSERT_EQ(r.render(), 1);
+
+    r.setImpl<VulkanBackend>(5);
+    ASSERT_TRUE(r.holds<VulkanBackend>());
+    ASSERT_EQ(r.render(), 10);
+
+    InlineRenderer v(std::in_place_type<VulkanBackend>, 2);
+    ASSERT_EQ(v.render(), 4);
+}
+
+// Counts calls made on an implementation after it was destroyed.
+std::atomic<int> callsOnDeadImpl{0};
+
+struct CountingImpl {
+    std::atomic<bool> alive{true};
+    int id;
+    explicit CountingImpl(int i) : id(i) {}
+    ~CountingImpl() { alive = false; }
+    int draw() const {
+        if (!alive) ++callsOnDeadImpl;
+        return id;
+    }
+};
+
+class SharedRenderer : public Bridge<CountingImpl, SnapshotThreaded> {
+public:
+    using Bridge::Bridge;
+    int render() { return pin()->draw(); }
+    int renderAndSwap(int id) {
+        auto p = pin();
+        setImpl(std::make_unique<CountingImpl>(id)); // Cannot wait for itself: deferred
+        return p->draw();
+    }
+    template <typename Fn>
+    void pinAndRun(Fn&& fn) {
+        auto p = pin();
+        fn();
+    }
+};
+
+TEST(Bridge_HotSwapUnderConcurrentCallers) {
+    SharedRenderer r(std::make_unique<CountingImpl>(0));
+    std::atomic<bool> done{false};
+    std::vector<std::thread> callers;
+    for (int t = 0; t < 3; ++t) {
+        callers.emplace_back([&] {
+            while (!done) {
+                r.render();
+                std::this_thread::yield(); // Don't starve the writer on small machines
+            }
+        });
+    }
+    for (int i = 1; i <= 500; ++i) r.setImpl(std::make_unique<CountingImpl>(i));
+    done = true;
+    for (auto& c : callers) c.join();
+
+    ASSERT_EQ(r.render(), 500);
+    ASSERT_EQ(r.renderAndSwap(501), 500);
+    r.reclaim();
+    ASSERT_EQ(r.render(), 501);
+    ASSERT_EQ(callsOnDeadImpl.load(), 0);
+}
+
+// A thread pinned on one bridge swaps another bridge's implementation while a
+// different thread is waiting in that bridge's setImpl for the first pin to close.
+TEST(Bridge_SwapWhilePinnedOnAnotherBridge) {
+    SharedRenderer first(std::make_unique<CountingImpl>(0));
+    SharedRenderer second(std::make_unique<CountingImpl>(0));
+    std::atomic<int> stage{0};
+
+    std::thread reader([&] {
+        first.pinAndRun([&] {
+            stage = 1;
+            while (stage != 2) std::this_thread::yield();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20)); // Let the writer start waiting
+            second.setImpl(std::make_unique<CountingImpl>(2));         // Pinned: deferred, must not block
+        });
+    });
+    while (stage != 1) std::this_thread::yield();
+    std::thread writer([&] {
+        stage = 2;
+        second.setImpl(std::make_unique<CountingImpl>(1)); // Waits for the reader's pin on first
+    });
+    writer.join();
+    reader.join();
+
+    second.reclaim();
+    ASSERT_EQ(second.render(), 2);
+    ASSERT_EQ(callsOnDeadImpl.load(), 0);
+}
+
 int main() { return NTest::run_all(); }
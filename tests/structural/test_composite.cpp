@@ -1,6 +1,12 @@
 #include <NTest.h>
 #include <gofpp/structural/composite.hpp>
 
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 using namespace gofpp;
 
 struct TestNode : Composite<TestNode> {
@@ -20,4 +26,221 @@ TEST(Composite_RecursiveOperation) {
     ASSERT_EQ(child2.count, 1);
 }
 
+struct FlatNode : FlatComposite<FlatNode> {
+    int id = 0;
+    std::vector<int>* order = nullptr;
+    void visit() override { order->push_back(id); }
+};
+
+TEST(Composite_FlatDepthFirstOrder) {
+    std::vector<int> order;
+    FlatNode n[5];
+    for (int i = 0; i < 5; ++i) { n[i].id = i; n[i].order = &order; }
+    n[0].add(&n[1]);
+    n[1].add(&n[2]);
+    n[0].add(&n[3]);
+
+    n[0].operation();
+    ASSERT_TRUE((order == std::vector<int>{0, 1, 2, 3}));
+    ASSERT_TRUE((n[0].layout().subtreeSize == std::vector<std::uint32_t>{4, 2, 1, 1}));
+
+    // A change deep in the tree invalidates the root's layout
+    n[2].add(&n[4]);
+    order.clear();
+    n[0].operation();
+    ASSERT_TRUE((order == std::vector<int>{0, 1, 2, 4, 3}));
+
+    n[0].remove(&n[1]);
+    order.clear();
+    n[0].traverse([](FlatNode& node) { node.visit(); });
+    ASSERT_TRUE((order == std::vector<int>{0, 3}));
+}
+
+struct StampedNode : FlatComposite<StampedNode> {
+    StampedNode* parent = nullptr;
+    std::atomic<int>* clock = nullptr;
+    int stamp = -1;
+    void visit() override { stamp = clock->fetch_add(1); }
+};
+
+TEST(Composite_ParallelVisitsEveryNodeOnce) {
+    constexpr int count = 2000;
+    std::atomic<int> clock{0};
+    std::vector<StampedNode> nodes(count);
+    for (int i = 0; i < count; ++i) {
+        nodes[i].clock = &clock;
+        if (i > 0) {
+            nodes[i].parent = &nodes[(i - 1) / 5];
+            nodes[i].parent->add(&nodes[i]);
+        }
+    }
+
+    TaskPool pool(4);
+    for (bool parentsFirst : {false, true}) {
+        clock = 0;
+        nodes[0].parallelOperation({.grain = 16, .parentsFirst = parentsFirst, .pool = &pool});
+        ASSERT_EQ(clock.load(), count);
+        if (parentsFirst) {
+            bool ordered = true;
+            for (auto& n : nodes) {
+                if (n.parent && n.parent->stamp >= n.stamp) ordered = false;
+            }
+            ASSERT_TRUE(ordered);
+        }
+    }
+}
+
+struct PricedItem : AggregateComposite<PricedItem, int> {
+    int price = 0;
+    int refreshes = 0;
+    int local() const override { return price; }
+    void refresh() override {
+        ++refreshes;
+        AggregateComposite<PricedItem, int>::refresh();
+    }
+};
+
+TEST(Composite_UpdateRefreshesDirtyPathOnly) {
+    PricedItem root, a, b, a1, a2;
+    root.add(&a);
+    root.add(&b);
+    a.add(&a1);
+    a.add(&a2);
+    a1.price = 1;
+    a2.price = 2;
+    b.price = 4;
+    root.update();
+    ASSERT_EQ(root.aggregate(), 7);
+    ASSERT_FALSE(root.isDirty());
+
+    for (auto* n : {&root, &a, &b, &a1, &a2}) n->refreshes = 0;
+    a2.price = 10;
+    a2.markDirty();
+    root.update();
+    ASSERT_EQ(root.aggregate(), 15);
+    ASSERT_EQ(a2.refreshes + a.refreshes + root.refreshes, 3);
+    ASSERT_EQ(a1.refreshes + b.refreshes, 0);
+
+    root.remove(&b);
+    root.update();
+    ASSERT_EQ(root.aggregate(), 11);
+}
+
+TEST(Composite_UpdateTracksDirtyChildren) {
+    // Deep enough to overflow the stack if update() recursed
+    std::vector<PricedItem> chain(1000000);
+    for (std::size_t i = chain.size() - 1; i > 0; --i) chain[i - 1].add(&chain[i]); // Bottom-up: O(1) per add
+    chain.back().price = 3;
+    chain.front().update();
+    ASSERT_EQ(chain.front().aggregate(), 3);
+
+    PricedItem root, a, b, a1, a2;
+    root.add(&a);
+    root.add(&b);
+    a.add(&a1);
+    a.add(&a2);
+    root.update();
+
+    // Updating a subtree leaves its parent dirty, and a later update() skips it
+    a1.price = 1;
+    a1.markDirty();
+    a.update();
+    ASSERT_FALSE(a.isDirty());
+    ASSERT_TRUE(root.isDirty());
+    for (auto* n : {&root, &a, &b, &a1, &a2}) n->refreshes = 0;
+    root.update();
+    ASSERT_EQ(root.aggregate(), 1);
+    ASSERT_EQ(root.refreshes, 1);
+    ASSERT_EQ(a.refreshes + a1.refreshes, 0);
+
+    // Dirty children that move or die take their place in the dirty list with them
+    a2.price = 2;
+    a2.markDirty();
+    b.add(&a2);
+    a1.price = 5;
+    a1.markDirty();
+    {
+        PricedItem temp;
+        a.add(&temp);
+    }
+    root.update();
+    ASSERT_EQ(a.aggregate(), 5);
+    ASSERT_EQ(b.aggregate(), 2);
+    ASSERT_EQ(root.aggregate(), 7);
+    ASSERT_FALSE(a2.isDirty());
+}
+
+struct NamedNode : KeyedComposite<NamedNode, std::string> {
+    std::string name;
+    explicit NamedNode(std::string n = {}) : name(std::move(n)) {}
+    const std::string& key() const { return name; }
+};
+
+TEST(Composite_RemoveAndKeyedLookup) {
+    NamedNode root("root"), a("a"), b("b"), c("c"), leaf("leaf");
+    root.add(&a);
+    root.add(&b);
+    root.add(&c);
+    b.add(&leaf);
+
+    ASSERT_EQ(root.find("b"), &b);
+    ASSERT_EQ(leaf.parent(), &b);
+    ASSERT_EQ(leaf.root(), &root);
+    ASSERT_TRUE((leaf.path() == std::vector<NamedNode*>{&root, &b, &leaf}));
+
+    root.remove(&a); // c moves into a's place
+    ASSERT_EQ(root.find("a"), nullptr);
+    ASSERT_EQ(a.parent(), nullptr);
+    root.remove(&c);
+    root.remove(&c); // Not a child any more: no-op
+    ASSERT_EQ(root.find("b"), &b);
+    ASSERT_EQ(root.find("c"), nullptr);
+
+    // Re-parenting detaches from the old parent
+    a.add(&leaf);
+    ASSERT_EQ(b.find("leaf"), nullptr);
+    ASSERT_EQ(a.find("leaf"), &leaf);
+    ASSERT_EQ(leaf.depth(), std::size_t(1));
+
+    NamedNode twin("leaf");
+    bool rejected = false;
+    try { a.add(&twin); } catch (const std::invalid_argument&) { rejected = true; }
+    ASSERT_TRUE(rejected);
+    ASSERT_EQ(twin.parent(), nullptr);
+}
+
+TEST(Composite_DestroyedNodesUnlink) {
+    auto parent = std::make_unique<TestNode>();
+    TestNode child, grandchild;
+    parent->add(&child);
+    child.add(&grandchild);
+    parent.reset(); // Parent goes first: the child must not keep pointing at it
+
+    ASSERT_EQ(child.parent(), nullptr);
+    ASSERT_EQ(grandchild.root(), &child);
+    child.markDirty();
+
+    TestNode adopter;
+    adopter.add(&child); // Re-parenting must not detach from the freed node
+    ASSERT_EQ(child.parent(), &adopter);
+    ASSERT_EQ(grandchild.depth(), std::size_t(2));
+    {
+        TestNode temp;
+        adopter.add(&temp);
+    } // Child goes first: the parent forgets it
+    adopter.operation();
+    ASSERT_EQ(child.count, 1);
+    ASSERT_EQ(grandchild.count, 1);
+
+    NamedNode root("root");
+    {
+        NamedNode a("a");
+        root.add(&a);
+    }
+    ASSERT_EQ(root.find("a"), nullptr);
+    NamedNode again("a");
+    root.add(&again); // The key was freed with its node
+    ASSERT_EQ(root.find("a"), &again);
+}
+
 int main() { return NTest::run_all(); }
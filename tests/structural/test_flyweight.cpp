@@ -1,6 +1,9 @@
 #include <NTest.h>
 #include <gofpp/structural/flyweight.hpp>
 
+#include <stdexcept>
+#include <utility>
+
 using namespace gofpp;
 
 struct Glyph {
@@ -20,4 +23,33 @@ TEST(Flyweight_SharedInstances) {
     ASSERT_NE(g1.get(), g3.get()); // different object
 }
 
+TEST(Flyweight_SharedMutexPolicy) {
+    FlyweightFactory<char, Glyph, SharedMutexThreaded> factory;
+    auto g1 = factory.get('A');
+    auto g2 = factory.get('A');
+    ASSERT_EQ(g1.get(), g2.get());
+    ASSERT_EQ(g2->character, 'A');
+}
+
+static bool failNextGlyph = false;
+
+struct FragileGlyph {
+    char character;
+    FragileGlyph(char c) : character(c) {
+        if (std::exchange(failNextGlyph, false)) throw std::runtime_error("glyph load failed");
+    }
+};
+
+TEST(Flyweight_FailedCreationLeavesNoEntry) {
+    FlyweightFactory<char, FragileGlyph, SharedMutexThreaded> factory;
+    failNextGlyph = true;
+    bool threw = false;
+    try { factory.get('A'); } catch (const std::runtime_error&) { threw = true; }
+    ASSERT_TRUE(threw);
+
+    auto g = factory.get('A'); // Retried, not a cached nullptr
+    ASSERT_TRUE(g != nullptr);
+    ASSERT_EQ(g->character, 'A');
+}
+
 int main() { return NTest::run_all(); }
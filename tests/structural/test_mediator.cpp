@@ -1,6 +1,10 @@
 #include <NTest.h>
 #include <gofpp/structural/mediator.hpp>
+#include <atomic>
+#include <chrono>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace gofpp;
 
@@ -17,4 +21,94 @@ TEST(Mediator_Notify) {
     ASSERT_EQ(m.lastEvent, "PanelA:Update");
 }
 
+TEST(Mediator_TypedRoutesByInternedIds) {
+    TypedMediator<int> m;
+    auto viewport = m.sender("Viewport");
+    auto outliner = m.sender("Outliner");
+    auto selected = m.event("SelectionChanged");
+    ASSERT_TRUE(m.sender("Viewport") == viewport);
+
+    std::vector<std::string> log;
+    m.on(viewport, selected, [&](int id) { log.push_back("viewport:" + std::to_string(id)); });
+    m.on(selected, [&](int id) { log.push_back("any:" + std::to_string(id)); });
+
+    m.send(viewport, selected, 1);
+    m.send(outliner, selected, 2);
+    ASSERT_TRUE((log == std::vector<std::string>{"viewport:1", "any:1", "any:2"}));
+
+    // Names registered after the first send extend the table
+    auto properties = m.sender("Properties");
+    auto renamed = m.event("Renamed");
+    m.on(properties, renamed, [&](int id) { log.push_back("renamed:" + std::to_string(id)); });
+    log.clear();
+    m.send("Properties", "Renamed", 3);
+    m.send(properties, selected, 4);
+    m.send("Nobody", "Renamed", 5);
+    ASSERT_TRUE((log == std::vector<std::string>{"renamed:3", "any:4"}));
+}
+
+TEST(Mediator_AsyncBackpressureModes) {
+    AsyncMediator<int> bus;
+    std::vector<int> got;
+    auto failing = bus.add([&](int& v) { got.push_back(v); }, {.capacity = 2, .backpressure = Backpressure::Fail});
+    auto dropping = bus.add([&](int& v) { got.push_back(v); }, {.capacity = 2, .backpressure = Backpressure::DropOldest});
+
+    ASSERT_TRUE(bus.post(failing, 1) == PostResult::Queued);
+    ASSERT_TRUE(bus.post(failing, 2) == PostResult::Queued);
+    ASSERT_TRUE(bus.post(failing, 3) == PostResult::Rejected);
+    ASSERT_EQ(bus.drain(failing), std::size_t(2));
+    ASSERT_TRUE((got == std::vector<int>{1, 2}));
+    ASSERT_EQ(bus.stats(failing).rejected, std::uint64_t(1));
+
+    got.clear();
+    for (int v = 1; v <= 3; ++v) bus.post(dropping, v);
+    auto s = bus.stats(dropping);
+    ASSERT_EQ(s.depth, std::size_t(2));
+    ASSERT_EQ(s.highWater, std::size_t(2));
+    ASSERT_EQ(s.dropped, std::uint64_t(1));
+    ASSERT_EQ(bus.drain(dropping, 1), std::size_t(1)); // Batch of one
+    ASSERT_EQ(bus.drainAll(), std::size_t(1));
+    ASSERT_TRUE((got == std::vector<int>{2, 3}));
+    ASSERT_EQ(bus.stats(dropping).delivered, std::uint64_t(2));
+}
+
+TEST(Mediator_AsyncBlockingProducers) {
+    AsyncMediator<int> bus;
+    long sum = 0;
+    auto box = bus.add([&](int& v) { sum += v; }, {.capacity = 8, .backpressure = Backpressure::Block});
+
+    std::thread consumer([&] {
+        while (bus.stats(box).delivered < 4000) {
+            if (bus.wait(box, std::chrono::milliseconds(10))) bus.drain(box, 16);
+        }
+    });
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; ++t) {
+        producers.emplace_back([&] {
+            for (int i = 1; i <= 1000; ++i) bus.post(box, i);
+        });
+    }
+    for (auto& p : producers) p.join();
+    consumer.join();
+
+    ASSERT_EQ(sum, 4L * 500500);
+    auto s = bus.stats(box);
+    ASSERT_EQ(s.posted, std::uint64_t(4000));
+    ASSERT_EQ(s.dropped + s.rejected, std::uint64_t(0));
+    ASSERT_TRUE(s.highWater <= 8);
+}
+
+TEST(Mediator_AsyncDrainOnPool) {
+    AsyncMediator<int> bus;
+    std::atomic<int> total{0};
+    std::vector<MailboxId> boxes;
+    for (int i = 0; i < 8; ++i) boxes.push_back(bus.add([&](int& v) { total += v; }));
+    bus.broadcast(1);
+    bus.broadcast(2);
+
+    TaskPool pool(3);
+    ASSERT_EQ(bus.drainAll(pool), std::size_t(16));
+    ASSERT_EQ(total.load(), 24);
+}
+
 int main() { return NTest::run_all(); }